@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Floating point reciprocal
 // This module is pipelined. It can calculate one reciprocal per clock.
 // To get a first approximation of 1/x, it uses some magic number. See the following link:
@@ -23,12 +25,23 @@
 // of iterations can be adapted to get the best tradeoff between logic utilization and accuracy.
 // This module has by default a latency of 25 + 1 clock cycles (3 iterations)
 // Minimum is one iteration (8 + 1 clock cycles of delay)
+// With UNPACKED = 1, the iterations are calculated in the unpacked format (see FloatUnpack).
+// Then each iteration requires only 5 clock cycles plus 2 clock cycles to unpack and pack the numbers.
 module ExampleNewtonRecip
 # (
     parameter MANTISSA_SIZE = 23,
-    parameter ITERATIONS = 3, // Reduce the iterations to lower the latency. Each iteration requires 8 clock cycles
+    parameter ITERATIONS = 3, // Reduce the iterations to lower the latency. Each iteration has a latency of ITERATION_LATENCY clock cycles
+    parameter UNPACKED = 0,
     localparam EXPONENT_SIZE = 8, // To avoid problems with the MAGIC_NUMBER, disable the configuration of the exponent
-    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam GUARD_SIZE = 2,
+    localparam UNPACKED_SIZE = 1 + (EXPONENT_SIZE + 2) + (2 + MANTISSA_SIZE + GUARD_SIZE),
+    localparam ITERATION_LATENCY = (UNPACKED) // Latency of one ReciprocalNewtonIteration
+        ? (2 * `FLOAT_MUL_UNPACKED_LATENCY(0)) + `FLOAT_SUB_UNPACKED_LATENCY
+        : (2 * `FLOAT_MUL_LATENCY(0)) + `FLOAT_SUB_LATENCY,
+    localparam LATENCY = (UNPACKED)
+        ? (ITERATION_LATENCY * ITERATIONS) + `FLOAT_UNPACK_LATENCY + `FLOAT_PACK_LATENCY + 1
+        : (ITERATION_LATENCY * ITERATIONS) + 1
 )
 (
     input  wire                      clk,
@@ -38,7 +51,6 @@ module ExampleNewtonRecip
 );
     localparam MAGIC_NUMBER = 32'h7EF127EA >> (32 - FLOAT_SIZE);
     localparam SIGN_POS = FLOAT_SIZE - 1;
-    localparam DELAY = 8;
 
     wire [FLOAT_SIZE - 1 : 0] inUnsigned = {1'b0, in[0 +: FLOAT_SIZE - 1]};
     wire [FLOAT_SIZE - 1 : 0] invEstimation = MAGIC_NUMBER[0 +: FLOAT_SIZE] - inUnsigned;
@@ -49,11 +61,8 @@ module ExampleNewtonRecip
     wire [FLOAT_SIZE - 1 : 0] result;
     wire                      signDelay;
 
-    wire [FLOAT_SIZE - 1 : 0] x [0 : ITERATIONS];
-    wire [FLOAT_SIZE - 1 : 0] iteration [0 : ITERATIONS];
-
-    ValueDelay #(.VALUE_SIZE(1), .DELAY((DELAY * ITERATIONS) + 1)) 
-        signDelayInst (.clk(clk), .in(in[SIGN_POS]), .out(signDelay));
+    ValueDelay #(.VALUE_SIZE(1), .DELAY(LATENCY)) 
+        signDelayInst (.clk(clk), .ce(ce), .in(in[SIGN_POS]), .out(signDelay));
 
     always @(posedge clk)
     if (ce) begin
@@ -61,36 +70,78 @@ module ExampleNewtonRecip
         invEstimationReg <= invEstimation;
     end
 
-    assign x[0] = inUnsignedReg;
-    assign iteration[0] = invEstimationReg;
-
     generate
     genvar i;
-    for (i = 0; i < ITERATIONS; i = i + 1) 
-    begin : NewtonIterations
-        ReciprocalNewtonIteration #(
-            .MANTISSA_SIZE(MANTISSA_SIZE),
-            .EXPONENT_SIZE(EXPONENT_SIZE)
-        ) newtonIteration (
-            .clk(clk),
-            .ce(ce),
-            .x(x[i]),
-            .currentIteration(iteration[i]),
-            .newIteration(iteration[i + 1])
-        );
-
-        ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
-            xDelay (.clk(clk), .in(x[i]), .out(x[i + 1]));
+    if (UNPACKED)
+    begin : Unpacked
+        wire [UNPACKED_SIZE - 1 : 0] xUnpacked [0 : ITERATIONS];
+        wire [UNPACKED_SIZE - 1 : 0] iterationUnpacked [0 : ITERATIONS];
+
+        FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+            xUnpack (.clk(clk), .ce(ce), .in(inUnsignedReg), .out(xUnpacked[0]));
+
+        FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+            iterationUnpack (.clk(clk), .ce(ce), .in(invEstimationReg), .out(iterationUnpacked[0]));
+
+        for (i = 0; i < ITERATIONS; i = i + 1) 
+        begin : NewtonIterations
+            ReciprocalNewtonIterationUnpacked #(
+                .MANTISSA_SIZE(MANTISSA_SIZE),
+                .EXPONENT_SIZE(EXPONENT_SIZE),
+                .GUARD_SIZE(GUARD_SIZE)
+            ) newtonIteration (
+                .clk(clk),
+                .ce(ce),
+                .x(xUnpacked[i]),
+                .currentIteration(iterationUnpacked[i]),
+                .newIteration(iterationUnpacked[i + 1])
+            );
+
+            ValueDelay #(.VALUE_SIZE(UNPACKED_SIZE), .DELAY(ITERATION_LATENCY)) 
+                xDelay (.clk(clk), .ce(ce), .in(xUnpacked[i]), .out(xUnpacked[i + 1]));
+        end
+
+        FloatPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+            iterationPack (.clk(clk), .ce(ce), .in(iterationUnpacked[ITERATIONS]), .out(result));
+    end
+    else
+    begin : Packed
+        wire [FLOAT_SIZE - 1 : 0] x [0 : ITERATIONS];
+        wire [FLOAT_SIZE - 1 : 0] iteration [0 : ITERATIONS];
+
+        assign x[0] = inUnsignedReg;
+        assign iteration[0] = invEstimationReg;
+
+        for (i = 0; i < ITERATIONS; i = i + 1) 
+        begin : NewtonIterations
+            ReciprocalNewtonIteration #(
+                .MANTISSA_SIZE(MANTISSA_SIZE),
+                .EXPONENT_SIZE(EXPONENT_SIZE)
+            ) newtonIteration (
+                .clk(clk),
+                .ce(ce),
+                .x(x[i]),
+                .currentIteration(iteration[i]),
+                .newIteration(iteration[i + 1])
+            );
+
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(ITERATION_LATENCY)) 
+                xDelay (.clk(clk), .ce(ce), .in(x[i]), .out(x[i + 1]));
+        end
+
+        assign result = iteration[ITERATIONS];
     end
     endgenerate
 
-    assign out = {signDelay, iteration[ITERATIONS][0 +: FLOAT_SIZE - 1]};
+    assign out = {signDelay, result[0 +: FLOAT_SIZE - 1]};
 endmodule
 
 module ReciprocalNewtonIteration #(
     parameter MANTISSA_SIZE = 23,
     parameter EXPONENT_SIZE = 8,
-    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam MUL_DELAY = 0,
+    localparam LATENCY = (2 * `FLOAT_MUL_LATENCY(MUL_DELAY)) + `FLOAT_SUB_LATENCY
 )
 (
     input  wire                      clk,
@@ -104,12 +155,13 @@ module ReciprocalNewtonIteration #(
     wire [FLOAT_SIZE - 1 : 0] twoMinusX;
     wire [FLOAT_SIZE - 1 : 0] currItMultX;
     wire [FLOAT_SIZE - 1 : 0] currentIterationDelay;
+    wire [FLOAT_SIZE - 1 : 0] twoMinusXBalanced;
 
     FloatMul 
     #(
         .MANTISSA_SIZE(MANTISSA_SIZE),
         .EXPONENT_SIZE(EXPONENT_SIZE),
-        .DELAY(0)
+        .DELAY(MUL_DELAY)
     ) 
     floatMul 
     (
@@ -139,17 +191,119 @@ module ReciprocalNewtonIteration #(
     #(
         .MANTISSA_SIZE(MANTISSA_SIZE),
         .EXPONENT_SIZE(EXPONENT_SIZE),
-        .DELAY(0)
+        .DELAY(MUL_DELAY)
+    ) 
+    floatMul2
+    (
+        .clk(clk),
+        .ce(ce),
+        .facAIn(currentIterationDelay),
+        .facBIn(twoMinusXBalanced),
+        .prod(newIteration)
+    );
+
+    // Align the current iteration with the result of 2 - x * currentIteration
+    ValueBalance #(
+        .A_SIZE(FLOAT_SIZE),
+        .B_SIZE(FLOAT_SIZE),
+        .A_LATENCY(0),
+        .B_LATENCY(`FLOAT_MUL_LATENCY(MUL_DELAY) + `FLOAT_SUB_LATENCY)
+    ) currentIterationBalance (
+        .clk(clk),
+        .ce(ce),
+        .aIn(currentIteration),
+        .bIn(twoMinusX),
+        .aOut(currentIterationDelay),
+        .bOut(twoMinusXBalanced)
+    );
+endmodule
+
+// Same as ReciprocalNewtonIteration, but in the unpacked format (see FloatUnpack)
+module ReciprocalNewtonIterationUnpacked #(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    localparam UNPACKED_EXPONENT_SIZE = EXPONENT_SIZE + 2,
+    localparam UNPACKED_MANTISSA_SIZE = 2 + MANTISSA_SIZE + GUARD_SIZE,
+    localparam UNPACKED_SIZE = 1 + UNPACKED_EXPONENT_SIZE + UNPACKED_MANTISSA_SIZE,
+    localparam MUL_DELAY = 0,
+    localparam LATENCY = (2 * `FLOAT_MUL_UNPACKED_LATENCY(MUL_DELAY)) + `FLOAT_SUB_UNPACKED_LATENCY
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [UNPACKED_SIZE - 1 : 0] x,
+    input  wire [UNPACKED_SIZE - 1 : 0] currentIteration,
+    output wire [UNPACKED_SIZE - 1 : 0] newIteration
+);
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam [UNPACKED_EXPONENT_SIZE - 1 : 0] TWO_POINT_ZERO_EXPONENT = EXPONENT_BIAS + 1;
+    localparam [UNPACKED_SIZE - 1 : 0] TWO_POINT_ZERO = { 1'b0, TWO_POINT_ZERO_EXPONENT, 2'b01, { (UNPACKED_MANTISSA_SIZE - 2) { 1'b0 } } };
+
+    wire [UNPACKED_SIZE - 1 : 0] twoMinusX;
+    wire [UNPACKED_SIZE - 1 : 0] currItMultX;
+    wire [UNPACKED_SIZE - 1 : 0] currentIterationDelay;
+    wire [UNPACKED_SIZE - 1 : 0] twoMinusXBalanced;
+
+    FloatMulUnpacked 
+    #(
+        .MANTISSA_SIZE(MANTISSA_SIZE),
+        .EXPONENT_SIZE(EXPONENT_SIZE),
+        .GUARD_SIZE(GUARD_SIZE),
+        .DELAY(MUL_DELAY)
+    ) 
+    floatMul 
+    (
+        .clk(clk),
+        .ce(ce),
+        .facAIn(x),
+        .facBIn(currentIteration),
+        .prod(currItMultX)
+    );
+
+    FloatSubUnpacked
+    #(
+        .MANTISSA_SIZE(MANTISSA_SIZE),
+        .EXPONENT_SIZE(EXPONENT_SIZE),
+        .GUARD_SIZE(GUARD_SIZE)
+    )
+    floatSub
+    (
+        .clk(clk),
+        .ce(ce),
+        .aIn(TWO_POINT_ZERO),
+        .bIn(currItMultX),
+        .sum(twoMinusX)
+    );
+
+    FloatMulUnpacked 
+    #(
+        .MANTISSA_SIZE(MANTISSA_SIZE),
+        .EXPONENT_SIZE(EXPONENT_SIZE),
+        .GUARD_SIZE(GUARD_SIZE),
+        .DELAY(MUL_DELAY)
     ) 
     floatMul2
     (
         .clk(clk),
         .ce(ce),
         .facAIn(currentIterationDelay),
-        .facBIn(twoMinusX),
+        .facBIn(twoMinusXBalanced),
         .prod(newIteration)
     );
 
-    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(6)) 
-        currentIterationDelayer (.clk(clk), .ce(ce), .in(currentIteration), .out(currentIterationDelay));
-endmodule
\ No newline at end of file
+    // Align the current iteration with the result of 2 - x * currentIteration
+    ValueBalance #(
+        .A_SIZE(UNPACKED_SIZE),
+        .B_SIZE(UNPACKED_SIZE),
+        .A_LATENCY(0),
+        .B_LATENCY(`FLOAT_MUL_UNPACKED_LATENCY(MUL_DELAY) + `FLOAT_SUB_UNPACKED_LATENCY)
+    ) currentIterationBalance (
+        .clk(clk),
+        .ce(ce),
+        .aIn(currentIteration),
+        .bIn(twoMinusX),
+        .aOut(currentIterationDelay),
+        .bOut(twoMinusXBalanced)
+    );
+endmodule
@@ -25,6 +25,11 @@
 // Include model header, generated from Verilating "top.v"
 #include "VExampleNewtonRecip.h"
 
+// The latency depends on UNPACKED and is configured via the Makefile
+#ifndef TEST_LATENCY
+#define TEST_LATENCY 25
+#endif
+
 void clk(VExampleNewtonRecip* t)
 {
     t->clk = 0;
@@ -66,7 +71,7 @@ TEST_CASE("Specific numbers", "[ExampleNewtonRecip]")
     {
         float a = (float)i * 0.001;
         top->in = *(uint32_t*)&a;
-        for (int j = 0; j < 25; j++)
+        for (int j = 0; j < TEST_LATENCY; j++)
         {
             clk(top);
             top->in = 0; // To test the pipeline
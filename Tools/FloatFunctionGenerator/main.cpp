@@ -0,0 +1,488 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Generates the init files of the FloatFunction.
+// For every segment, a minimax polynomial is fitted with the Remez algorithm. The coefficients
+// are rounded to the fixed point format of the FixedFunction and the error of the quantized
+// polynomial is measured with a model of the hardware. If the number of mantissa bits which
+// select the segment is not given, the smallest number which reaches the error target is used.
+// The search stops at --max-mantissa-bits or when more segments don't reduce the error anymore
+// (for instance when the error target can't be reached for the tail of a function).
+//
+// Build:
+//   g++ -O2 -std=c++17 main.cpp -o FloatFunctionGenerator
+// Usage:
+//   FloatFunctionGenerator <function> <output prefix> [options]
+//   Functions: tanh, sigmoid, gelu, silu, softplus, erf, exp
+//   Options:
+//     --mantissa <n>            MANTISSA_SIZE of the float (23)
+//     --exponent <n>            EXPONENT_SIZE of the float (8)
+//     --degree <n>              DEGREE of the polynomials (2)
+//     --guard <n>               GUARD_SIZE (6)
+//     --exponent-min <n>        EXPONENT_MIN (-8)
+//     --exponent-bits <n>       SEGMENT_EXPONENT_BITS (4)
+//     --mantissa-bits <n>       SEGMENT_MANTISSA_BITS (searched if not given)
+//     --max-mantissa-bits <n>   Biggest SEGMENT_MANTISSA_BITS of the search (10)
+//     --error <ulp>             Error target (1.0)
+//     --absolute-below <n>      Results with |f(x)| < 2 ** n are measured in ulp of 2 ** n (absolute error).
+//                               Use it for functions with exponential tails like sigmoid, gelu, silu or softplus.
+// The generator writes <output prefix>_coefficients.mem and <output prefix>_scales.mem and
+// prints the parameters of the FloatFunction.
+// The error is measured in ulp of the biggest result of a segment.
+// To add a custom function, add it to FUNCTIONS.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+static const std::map<std::string, std::function<double(double)>> FUNCTIONS {
+    { "tanh", [](double x) { return std::tanh(x); } },
+    { "sigmoid", [](double x) { return 1.0 / (1.0 + std::exp(-x)); } },
+    // erfc avoids the cancellation of 1 + erf(x) in the negative tail
+    { "gelu", [](double x) { return 0.5 * x * std::erfc(-x / std::sqrt(2.0)); } },
+    { "silu", [](double x) { return x / (1.0 + std::exp(-x)); } },
+    { "softplus", [](double x) { return (x > 30.0) ? x : std::log1p(std::exp(x)); } },
+    { "erf", [](double x) { return std::erf(x); } },
+    { "exp", [](double x) { return std::exp(x); } },
+};
+
+struct Config
+{
+    int mantissaSize { 23 };
+    int exponentSize { 8 };
+    int degree { 2 };
+    int guardSize { 6 };
+    int exponentMin { -8 };
+    int exponentBits { 4 };
+    int mantissaBits { -1 };
+    int maxMantissaBits { 10 };
+    double error { 1.0 };
+    int absoluteBelow { -1000000 };
+
+    int fractionSize() const { return mantissaSize + guardSize; }
+    int valueSize() const { return fractionSize() + 3; }
+    int uSize() const { return mantissaSize - mantissaBits; }
+    int segments() const { return 1 << (1 + exponentBits + mantissaBits); }
+    int exponentMax() const { return exponentMin + (1 << exponentBits) - 1; }
+};
+
+struct Segment
+{
+    std::vector<int64_t> coefficients {}; // Fixed point, c0 first
+    int exponent { 0 };
+    double error { 0.0 }; // ulp
+};
+
+// Start of the segment and width of the segment (x = start + (width * u))
+void segmentRange(const Config& cfg, int segment, double& start, double& width)
+{
+    const int k = segment & ((1 << cfg.mantissaBits) - 1);
+    const int index = (segment >> cfg.mantissaBits) & ((1 << cfg.exponentBits) - 1);
+    const bool negative = (segment >> (cfg.exponentBits + cfg.mantissaBits)) & 1;
+    if (index == 0)
+    {
+        width = std::ldexp(1.0, cfg.exponentMin - cfg.mantissaBits);
+        start = k * width;
+    }
+    else
+    {
+        const int e = cfg.exponentMin + index - 1;
+        width = std::ldexp(1.0, e - cfg.mantissaBits);
+        start = std::ldexp(1.0, e) + (k * width);
+    }
+    if (negative)
+    {
+        start = -start;
+        width = -width;
+    }
+}
+
+// Hardware: Horner in fixed point, conversion with IntToFloat and scaling with the exponent of the segment
+double evaluate(const Config& cfg, const Segment& s, int64_t u)
+{
+    const int uSize = cfg.uSize();
+    int64_t acc = s.coefficients[cfg.degree];
+    for (int j = cfg.degree - 1; j >= 0; j--)
+    {
+        // The product is truncated (arithmetic shift)
+        const __int128 prod = (__int128)acc * u;
+        acc = (int64_t)(prod >> uSize) + s.coefficients[j];
+    }
+    if (acc == 0)
+        return 0.0;
+    // IntToFloat rounds the magnitude to MANTISSA_SIZE + 1 bits
+    const double magnitude = std::fabs((double)acc);
+    const int shift = std::ilogb(magnitude) - cfg.mantissaSize;
+    double rounded = magnitude;
+    if (shift > 0)
+        rounded = std::ldexp(std::floor(std::ldexp(magnitude, -shift) + 0.5), shift);
+    return std::ldexp((acc < 0) ? -rounded : rounded, s.exponent - cfg.fractionSize());
+}
+
+// Solves a * x = b with Gaussian elimination
+std::vector<double> solve(std::vector<std::vector<double>> a, std::vector<double> b)
+{
+    const size_t n = b.size();
+    for (size_t i = 0; i < n; i++)
+    {
+        size_t pivot = i;
+        for (size_t r = i + 1; r < n; r++)
+            if (std::fabs(a[r][i]) > std::fabs(a[pivot][i]))
+                pivot = r;
+        std::swap(a[i], a[pivot]);
+        std::swap(b[i], b[pivot]);
+        for (size_t r = i + 1; r < n; r++)
+        {
+            const double f = a[r][i] / a[i][i];
+            for (size_t c = i; c < n; c++)
+                a[r][c] -= f * a[i][c];
+            b[r] -= f * b[i];
+        }
+    }
+    std::vector<double> x(n);
+    for (size_t i = n; i-- > 0;)
+    {
+        double sum = b[i];
+        for (size_t c = i + 1; c < n; c++)
+            sum -= a[i][c] * x[c];
+        x[i] = sum / a[i][i];
+    }
+    return x;
+}
+
+double polynomial(const std::vector<double>& c, double t)
+{
+    double acc = 0.0;
+    for (size_t j = c.size(); j-- > 0;)
+        acc = (acc * t) + c[j];
+    return acc;
+}
+
+// Minimax polynomial of the degree n of g(t) in the range 0.0 .. 1.0 (Remez algorithm)
+std::vector<double> remez(const std::function<double(double)>& g, int n)
+{
+    constexpr int GRID_SIZE = 2048;
+    std::vector<double> grid(GRID_SIZE + 1);
+    std::vector<double> values(GRID_SIZE + 1);
+    for (int i = 0; i <= GRID_SIZE; i++)
+    {
+        grid[i] = (double)i / GRID_SIZE;
+        values[i] = g(grid[i]);
+    }
+
+    // Start with the extrema of the Chebyshev polynomial
+    std::vector<double> reference(n + 2);
+    for (int i = 0; i < n + 2; i++)
+        reference[i] = 0.5 * (1.0 - std::cos(M_PI * i / (n + 1)));
+
+    std::vector<double> best;
+    double bestError = INFINITY;
+    for (int iteration = 0; iteration < 30; iteration++)
+    {
+        // p(t_i) + (-1)^i * E = g(t_i)
+        std::vector<std::vector<double>> a(n + 2, std::vector<double>(n + 2));
+        std::vector<double> b(n + 2);
+        for (int i = 0; i < n + 2; i++)
+        {
+            double power = 1.0;
+            for (int j = 0; j <= n; j++)
+            {
+                a[i][j] = power;
+                power *= reference[i];
+            }
+            a[i][n + 1] = (i & 1) ? -1.0 : 1.0;
+            b[i] = g(reference[i]);
+        }
+        std::vector<double> c = solve(a, b);
+        c.resize(n + 1);
+
+        // Find the alternating extrema of the error
+        std::vector<double> error(GRID_SIZE + 1);
+        double maxError = 0.0;
+        for (int i = 0; i <= GRID_SIZE; i++)
+        {
+            error[i] = values[i] - polynomial(c, grid[i]);
+            maxError = std::fmax(maxError, std::fabs(error[i]));
+        }
+        if (!std::isfinite(maxError))
+            break;
+        if (maxError < bestError)
+        {
+            bestError = maxError;
+            best = c;
+        }
+
+        std::vector<int> extrema;
+        for (int i = 0; i <= GRID_SIZE; i++)
+        {
+            const bool left = (i == 0) || (std::fabs(error[i]) >= std::fabs(error[i - 1]));
+            const bool right = (i == GRID_SIZE) || (std::fabs(error[i]) >= std::fabs(error[i + 1]));
+            if (!(left && right))
+                continue;
+            if (!extrema.empty() && ((error[extrema.back()] >= 0.0) == (error[i] >= 0.0)))
+            {
+                // Same sign: keep the bigger one
+                if (std::fabs(error[i]) > std::fabs(error[extrema.back()]))
+                    extrema.back() = i;
+            }
+            else
+            {
+                extrema.push_back(i);
+            }
+        }
+        // Remove the smaller ends till n + 2 extrema are left
+        while ((int)extrema.size() > (n + 2))
+        {
+            if (std::fabs(error[extrema.front()]) < std::fabs(error[extrema.back()]))
+                extrema.erase(extrema.begin());
+            else
+                extrema.pop_back();
+        }
+        if ((int)extrema.size() < (n + 2))
+            break;
+
+        double minExtremum = INFINITY;
+        for (int i = 0; i < n + 2; i++)
+        {
+            reference[i] = grid[extrema[i]];
+            minExtremum = std::fmin(minExtremum, std::fabs(error[extrema[i]]));
+        }
+        if ((maxError - minExtremum) <= (maxError * 1e-6))
+            break;
+    }
+    return best;
+}
+
+// Fits and quantizes the polynomial of one segment and measures the error
+Segment fitSegment(const Config& cfg, const std::function<double(double)>& f, int segment)
+{
+    double start;
+    double width;
+    segmentRange(cfg, segment, start, width);
+    const int64_t uMax = (int64_t)1 << cfg.uSize();
+    auto g = [&](double t) { return f(start + (width * t)); };
+
+    Segment s;
+    s.coefficients.assign(cfg.degree + 1, 0);
+
+    // The exponent of the segment scales the biggest result into the range of -1.0 .. 1.0
+    double maxValue = 0.0;
+    constexpr int SAMPLES = 1024;
+    for (int i = 0; i <= SAMPLES; i++)
+        maxValue = std::fmax(maxValue, std::fabs(g((double)i / SAMPLES)));
+    const int exponentLimit = 1 << (cfg.exponentSize - 1);
+    if ((maxValue == 0.0) || ((std::ilogb(maxValue) + 1) < -exponentLimit))
+    {
+        // Results which are too small for the float are flushed to zero
+        return s;
+    }
+    s.exponent = std::ilogb(maxValue) + 1;
+    if (s.exponent >= exponentLimit)
+    {
+        std::fprintf(stderr, "Results of segment %d are too big for the float\n", segment);
+        std::exit(1);
+    }
+
+    const double scale = std::ldexp(1.0, -s.exponent);
+    const std::vector<double> c = remez([&](double t) { return g(t) * scale; }, cfg.degree);
+    const double valueMax = std::ldexp(1.0, cfg.valueSize() - 1);
+    for (int j = 0; j <= cfg.degree; j++)
+    {
+        const double fixed = std::round(std::ldexp(c[j], cfg.fractionSize()));
+        if (std::fabs(fixed) >= valueMax)
+        {
+            // The segment is too big for the polynomial
+            s.error = INFINITY;
+            return s;
+        }
+        s.coefficients[j] = (int64_t)fixed;
+    }
+
+    // Measure the error with the positions which are used by the hardware
+    const double ulp = std::ldexp(1.0, std::max(std::ilogb(maxValue), cfg.absoluteBelow) - cfg.mantissaSize);
+    const int64_t step = (uMax > 4096) ? (uMax / 4096) : 1;
+    for (int64_t u = 0; u < uMax; u += step)
+    {
+        for (int64_t v : { u, std::min(u + step - 1, uMax - 1) })
+        {
+            const double reference = g((double)v / (double)uMax);
+            s.error = std::fmax(s.error, std::fabs(evaluate(cfg, s, v) - reference) / ulp);
+        }
+    }
+    return s;
+}
+
+// worstSegment is the segment with the biggest error
+std::vector<Segment> fit(const Config& cfg, const std::function<double(double)>& f, double& maxError, int& worstSegment)
+{
+    std::vector<Segment> segments;
+    maxError = 0.0;
+    worstSegment = 0;
+    for (int i = 0; i < cfg.segments(); i++)
+    {
+        segments.push_back(fitSegment(cfg, f, i));
+        if (!(segments.back().error <= maxError))
+        {
+            maxError = segments.back().error;
+            worstSegment = i;
+        }
+    }
+    return segments;
+}
+
+std::string toHex(const std::vector<bool>& bits)
+{
+    static const char* DIGITS = "0123456789abcdef";
+    std::string hex;
+    for (size_t i = (bits.size() + 3) / 4; i-- > 0;)
+    {
+        int digit = 0;
+        for (size_t b = 0; b < 4; b++)
+            if (((i * 4) + b) < bits.size() && bits[(i * 4) + b])
+                digit |= 1 << b;
+        hex += DIGITS[digit];
+    }
+    return hex;
+}
+
+void appendBits(std::vector<bool>& bits, int64_t value, int size)
+{
+    for (int i = 0; i < size; i++)
+        bits.push_back((value >> std::min(i, 63)) & 1);
+}
+
+void write(const Config& cfg, const std::vector<Segment>& segments, const std::string& prefix)
+{
+    std::ofstream coefficients { prefix + "_coefficients.mem" };
+    std::ofstream scales { prefix + "_scales.mem" };
+    for (const Segment& s : segments)
+    {
+        // c0 is in the LSBs
+        std::vector<bool> bits;
+        for (int j = 0; j <= cfg.degree; j++)
+            appendBits(bits, s.coefficients[j], cfg.valueSize());
+        coefficients << toHex(bits) << "\n";
+
+        bits.clear();
+        appendBits(bits, s.exponent, cfg.exponentSize);
+        scales << toHex(bits) << "\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3 || FUNCTIONS.find(argv[1]) == FUNCTIONS.end())
+    {
+        std::fprintf(stderr, "Usage: %s <function> <output prefix> [options] (see main.cpp)\n", argv[0]);
+        return 1;
+    }
+    const std::function<double(double)>& f = FUNCTIONS.at(argv[1]);
+    const std::string prefix = argv[2];
+
+    Config cfg;
+    const std::map<std::string, int*> options {
+        { "--mantissa", &cfg.mantissaSize },
+        { "--exponent", &cfg.exponentSize },
+        { "--degree", &cfg.degree },
+        { "--guard", &cfg.guardSize },
+        { "--exponent-min", &cfg.exponentMin },
+        { "--exponent-bits", &cfg.exponentBits },
+        { "--mantissa-bits", &cfg.mantissaBits },
+        { "--max-mantissa-bits", &cfg.maxMantissaBits },
+        { "--absolute-below", &cfg.absoluteBelow },
+    };
+    for (int i = 3; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--error") == 0)
+            cfg.error = std::atof(argv[i + 1]);
+        else if (options.find(argv[i]) != options.end())
+            *options.at(argv[i]) = std::atoi(argv[i + 1]);
+        else
+        {
+            std::fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    std::vector<Segment> segments;
+    double maxError = INFINITY;
+    int worstSegment = 0;
+    if (cfg.mantissaBits >= 0)
+    {
+        segments = fit(cfg, f, maxError, worstSegment);
+    }
+    else
+    {
+        // Stop when the error isn't reduced by more segments. Each additional bit should reduce
+        // the error of a smooth function by about 2 ** (DEGREE + 1). Wide segments can reduce
+        // it slower, therefore a few bits without a halving of the error are accepted.
+        constexpr int MAX_STALLS = 3;
+        const int maxMantissaBits = std::min(cfg.maxMantissaBits, cfg.mantissaSize - 1);
+        double bestError = INFINITY;
+        int stalls = 0;
+        for (cfg.mantissaBits = 0; cfg.mantissaBits <= maxMantissaBits; cfg.mantissaBits++)
+        {
+            segments = fit(cfg, f, maxError, worstSegment);
+            std::fprintf(stderr, "SEGMENT_MANTISSA_BITS %d: max error %f ulp\n", cfg.mantissaBits, maxError);
+            if (maxError <= cfg.error)
+                break;
+            // Segments which are too big for the polynomial (inf) are not counted as stall
+            stalls = (!std::isfinite(bestError) || (maxError < (bestError * 0.5))) ? 0 : stalls + 1;
+            bestError = std::fmin(bestError, maxError);
+            if (stalls >= MAX_STALLS)
+            {
+                std::fprintf(stderr, "The error isn't reduced by more segments anymore\n");
+                break;
+            }
+        }
+        if (cfg.mantissaBits > maxMantissaBits)
+            cfg.mantissaBits = maxMantissaBits;
+    }
+    if (!(maxError <= cfg.error))
+    {
+        double start;
+        double width;
+        segmentRange(cfg, worstSegment, start, width);
+        std::fprintf(stderr, "Error target not reached with SEGMENT_MANTISSA_BITS %d, max error %f ulp in segment %d (%g .. %g)\n",
+            cfg.mantissaBits, maxError, worstSegment, start, start + width);
+        std::fprintf(stderr, "Try a higher --degree, --absolute-below or a bigger --error\n");
+        return 1;
+    }
+
+    write(cfg, segments, prefix);
+    std::printf("Max error %f ulp for %g <= |x| < %g\n", maxError, std::ldexp(1.0, cfg.exponentMin), std::ldexp(1.0, cfg.exponentMax()));
+    std::printf("FloatFunction #(\n");
+    std::printf("    .MANTISSA_SIZE(%d),\n", cfg.mantissaSize);
+    std::printf("    .EXPONENT_SIZE(%d),\n", cfg.exponentSize);
+    std::printf("    .EXPONENT_MIN(%d),\n", cfg.exponentMin);
+    std::printf("    .SEGMENT_EXPONENT_BITS(%d),\n", cfg.exponentBits);
+    std::printf("    .SEGMENT_MANTISSA_BITS(%d),\n", cfg.mantissaBits);
+    std::printf("    .DEGREE(%d),\n", cfg.degree);
+    std::printf("    .GUARD_SIZE(%d),\n", cfg.guardSize);
+    std::printf("    .COEFFICIENTS_FILE(\"%s_coefficients.mem\"),\n", prefix.c_str());
+    std::printf("    .SCALES_FILE(\"%s_scales.mem\")\n", prefix.c_str());
+    std::printf(")\n");
+    return 0;
+}
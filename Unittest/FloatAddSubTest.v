@@ -0,0 +1,46 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Test harness which runs the FloatAddSub and a FloatAdd and a FloatSub with the same
+// operands as reference. All have the same latency.
+module FloatAddSubTest
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] aIn,
+    input  wire [FLOAT_SIZE - 1 : 0] bIn,
+    output wire [FLOAT_SIZE - 1 : 0] sum,
+    output wire [FLOAT_SIZE - 1 : 0] diff,
+    output wire [FLOAT_SIZE - 1 : 0] refSum,
+    output wire [FLOAT_SIZE - 1 : 0] refDiff
+);
+    FloatAddSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        dut (.clk(clk), .ce(ce), .aIn(aIn), .bIn(bIn), .sum(sum), .diff(diff));
+
+    FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        referenceAdd (.clk(clk), .ce(ce), .aIn(aIn), .bIn(bIn), .sum(refSum));
+
+    FloatSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        referenceSub (.clk(clk), .ce(ce), .aIn(aIn), .bIn(bIn), .sum(refDiff));
+endmodule
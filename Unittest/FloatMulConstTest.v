@@ -0,0 +1,43 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Test harness which runs the FloatMulConst and a FloatMul with the same
+// constant as reference. Both have the same latency.
+module FloatMulConstTest
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter [EXPONENT_SIZE + MANTISSA_SIZE : 0] CONSTANT = 32'h40490fdb,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam DELAY = 1,
+    localparam REFERENCE_DELAY = `FLOAT_MUL_CONST_LATENCY(DELAY) - `FLOAT_MUL_LATENCY(0)
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] in,
+    output wire [FLOAT_SIZE - 1 : 0] prod,
+    output wire [FLOAT_SIZE - 1 : 0] refProd
+);
+    FloatMulConst #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .CONSTANT(CONSTANT), .DELAY(DELAY))
+        dut (.clk(clk), .ce(ce), .in(in), .prod(prod));
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(REFERENCE_DELAY))
+        reference (.clk(clk), .ce(ce), .facAIn(in), .facBIn(CONSTANT), .prod(refProd));
+endmodule
@@ -0,0 +1,62 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Test harness which runs the FloatMulDoublePumped and two single clock FloatMul
+// as reference with the same inputs. The FloatMul are delayed, so that both
+// have the same latency.
+module FloatMulDoublePumpedTest
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam DELAY = 0,
+    localparam REFERENCE_DELAY = `FLOAT_MUL_DOUBLE_PUMPED_LATENCY(DELAY) - `FLOAT_MUL_LATENCY(0)
+)
+(
+    input  wire                      clk,
+    input  wire                      clk2x,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] facA0In,
+    input  wire [FLOAT_SIZE - 1 : 0] facB0In,
+    input  wire [FLOAT_SIZE - 1 : 0] facA1In,
+    input  wire [FLOAT_SIZE - 1 : 0] facB1In,
+    output wire [FLOAT_SIZE - 1 : 0] prod0,
+    output wire [FLOAT_SIZE - 1 : 0] prod1,
+    output wire [FLOAT_SIZE - 1 : 0] refProd0,
+    output wire [FLOAT_SIZE - 1 : 0] refProd1
+);
+    FloatMulDoublePumped #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(DELAY))
+        dut (
+            .clk(clk),
+            .clk2x(clk2x),
+            .ce(ce),
+            .facA0In(facA0In),
+            .facB0In(facB0In),
+            .facA1In(facA1In),
+            .facB1In(facB1In),
+            .prod0(prod0),
+            .prod1(prod1)
+        );
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(REFERENCE_DELAY))
+        ref0 (.clk(clk), .ce(ce), .facAIn(facA0In), .facBIn(facB0In), .prod(refProd0));
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(REFERENCE_DELAY))
+        ref1 (.clk(clk), .ce(ce), .facAIn(facA1In), .facBIn(facB1In), .prod(refProd1));
+endmodule
@@ -0,0 +1,72 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Test harness for the unpacked format. The inputs are unpacked, processed
+// with the *Unpacked modules and packed again.
+module FloatUnpackedTest
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam UNPACKED_SIZE = 1 + (EXPONENT_SIZE + 2) + (2 + MANTISSA_SIZE + GUARD_SIZE)
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] aIn,
+    input  wire [FLOAT_SIZE - 1 : 0] bIn,
+    output wire [FLOAT_SIZE - 1 : 0] roundTrip, // pack(unpack(a))
+    output wire [FLOAT_SIZE - 1 : 0] prod, // a * b
+    output wire [FLOAT_SIZE - 1 : 0] sum, // a + b
+    output wire [FLOAT_SIZE - 1 : 0] diff // a - b
+);
+    wire [UNPACKED_SIZE - 1 : 0] aUnpacked;
+    wire [UNPACKED_SIZE - 1 : 0] bUnpacked;
+    wire [UNPACKED_SIZE - 1 : 0] prodUnpacked;
+    wire [UNPACKED_SIZE - 1 : 0] sumUnpacked;
+    wire [UNPACKED_SIZE - 1 : 0] diffUnpacked;
+
+    FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        aUnpack (.clk(clk), .ce(ce), .in(aIn), .out(aUnpacked));
+
+    FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        bUnpack (.clk(clk), .ce(ce), .in(bIn), .out(bUnpacked));
+
+    FloatMulUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        mul (.clk(clk), .ce(ce), .facAIn(aUnpacked), .facBIn(bUnpacked), .prod(prodUnpacked));
+
+    FloatAddUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        add (.clk(clk), .ce(ce), .aIn(aUnpacked), .bIn(bUnpacked), .sum(sumUnpacked));
+
+    FloatSubUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        sub (.clk(clk), .ce(ce), .aIn(aUnpacked), .bIn(bUnpacked), .sum(diffUnpacked));
+
+    FloatPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        roundTripPack (.clk(clk), .ce(ce), .in(aUnpacked), .out(roundTrip));
+
+    FloatPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        prodPack (.clk(clk), .ce(ce), .in(prodUnpacked), .out(prod));
+
+    FloatPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        sumPack (.clk(clk), .ce(ce), .in(sumUnpacked), .out(sum));
+
+    FloatPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        diffPack (.clk(clk), .ce(ce), .in(diffUnpacked), .out(diff));
+endmodule
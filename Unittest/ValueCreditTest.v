@@ -0,0 +1,81 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Test harness which models a pipeline with a fixed latency (a ValueDelay),
+// which writes its results into a ValueFifo. The free entries of the FIFO
+// are tracked with a ValueCredit.
+module ValueCreditTest
+# (
+    parameter VALUE_SIZE = 32,
+    parameter LATENCY = 8,
+    parameter DEPTH = 16,
+    parameter ALMOST_FULL_THRESHOLD = 4,
+    localparam CREDIT_SIZE = $clog2(DEPTH + 1)
+)
+(
+    input  wire                         clk,
+    input  wire                         resetn,
+
+    input  wire                         issue,
+    input  wire [VALUE_SIZE - 1 : 0]    in,
+
+    output wire                         outValid,
+    input  wire                         outReady,
+    output wire [VALUE_SIZE - 1 : 0]    out,
+
+    output wire                         fifoInValid,
+    output wire                         fifoFull,
+    output wire [CREDIT_SIZE - 1 : 0]   fifoFill,
+
+    output wire [CREDIT_SIZE - 1 : 0]   credits,
+    output wire                         creditAvailable,
+    output wire                         almostFull,
+    output wire                         valueInPipeline
+);
+    wire [VALUE_SIZE - 1 : 0] pipelineOut;
+
+    ValueDelay #(.VALUE_SIZE(VALUE_SIZE + 1), .DELAY(LATENCY))
+        pipeline (.clk(clk), .ce(1'b1), .in({ issue && resetn, in }), .out({ fifoInValid, pipelineOut }));
+
+    ValueFifo #(.VALUE_SIZE(VALUE_SIZE), .DEPTH(DEPTH))
+        fifo (
+            .aclk(clk), 
+            .resetn(resetn), 
+            .inValid(fifoInValid), 
+            .in(pipelineOut), 
+            .outValid(outValid), 
+            .outReady(outReady), 
+            .out(out), 
+            .empty(), 
+            .full(fifoFull), 
+            .fill(fifoFill)
+        );
+
+    ValueCredit #(.CREDITS(DEPTH), .ALMOST_FULL_THRESHOLD(ALMOST_FULL_THRESHOLD))
+        dut (
+            .aclk(clk), 
+            .resetn(resetn), 
+            .sigIncomingValue(issue), 
+            .sigOutgoingValue(outValid && outReady), 
+            .credits(credits), 
+            .creditAvailable(creditAvailable), 
+            .almostFull(almostFull), 
+            .valueInPipeline(valueInPipeline)
+        );
+endmodule
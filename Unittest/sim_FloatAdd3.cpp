@@ -0,0 +1,260 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <algorithm>
+#include <cfenv>
+#include <cfloat>
+#include <cmath>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatAdd3.h"
+
+void clk(VFloatAdd3* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+// The sum of three floats with close exponents is exact in a double.
+// The FloatAdd3 rounds to nearest with ties away from zero.
+uint32_t referenceAdd3(uint32_t a, uint32_t b, uint32_t c)
+{
+    const double sum = (double)*(float*)&a + (double)*(float*)&b + (double)*(float*)&c;
+    const int round = std::fegetround();
+    std::fesetround(FE_TOWARDZERO);
+    volatile float truncated = (float)sum;
+    std::fesetround(round);
+    const float away = std::nextafter((float)truncated, (sum < 0) ? -INFINITY : INFINITY);
+    float result = truncated;
+    if (std::fabs(sum - (double)truncated) >= std::fabs((double)away - (double)truncated) / 2.0)
+        result = away;
+    if (result == 0.0f)
+        result = 0.0f; // The FloatAdd3 always returns a positive zero
+    return *(uint32_t*)&result;
+}
+
+void testAdd3(VFloatAdd3* top, uint32_t a, uint32_t b, uint32_t c, uint32_t result)
+{
+    top->aIn = a;
+    top->bIn = b;
+    top->cIn = c;
+    // The pipeline has a latency of 4 clocks until the result is computed.
+    clk(top);
+    clk(top);
+    clk(top);
+    clk(top);
+    REQUIRE(top->sum == result);
+}
+
+TEST_CASE("Close exponents are exactly rounded", "[FloatAdd3]")
+{
+    VFloatAdd3* top = new VFloatAdd3 { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    top->ce = 1;
+
+    // When the exponents differ by up to GUARD_SIZE (3), no bits are truncated during the alignment
+    auto randomFloat = [&](uint32_t exponent) {
+        return (rng() & 0x807fffff) | ((exponent + (rng() % 4)) << 23);
+    };
+
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        const uint32_t exponent = 1 + (rng() % 240);
+        const uint32_t a = randomFloat(exponent);
+        const uint32_t b = randomFloat(exponent);
+        const uint32_t c = randomFloat(exponent);
+        testAdd3(top, a, b, c, referenceAdd3(a, b, c));
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Error bound over the full exponent range", "[FloatAdd3]")
+{
+    VFloatAdd3* top = new VFloatAdd3 { new VerilatedContext };
+    std::mt19937 rng { 5678 };
+    top->ce = 1;
+
+    // Random sign, mantissa and exponent (including denormalized numbers)
+    auto randomFloat = [&]() {
+        return (rng() & 0x807fffff) | ((rng() % 255) << 23);
+    };
+
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        uint32_t a = randomFloat();
+        uint32_t b = randomFloat();
+        uint32_t c = randomFloat();
+        switch (i % 4)
+        {
+        case 1:
+            // Cancellation of a and b, c is much smaller
+            b = a ^ 0x80000000;
+            break;
+        case 2:
+            // Partial cancellation of a and b
+            b = ((a ^ 0x80000000) & 0xff800000) | ((a + (rng() % 16) - 8) & 0x007fffff);
+            break;
+        case 3:
+            // Close exponents with mixed signs
+            b = (randomFloat() & 0x807fffff) | (a & 0x7f800000);
+            break;
+        default:
+            break;
+        }
+
+        const float fa = *(float*)&a;
+        const float fb = *(float*)&b;
+        const float fc = *(float*)&c;
+        const double maxOperand = std::fmax(std::fabs(fa), std::fmax(std::fabs(fb), std::fabs(fc)));
+        // The sum of three floats is nearly exact in a long double
+        const long double exact = (long double)fa + (long double)fb + (long double)fc;
+
+        top->aIn = a;
+        top->bIn = b;
+        top->cIn = c;
+        clk(top);
+        clk(top);
+        clk(top);
+        clk(top);
+
+        const uint32_t sum = top->sum;
+        const float fsum = *(float*)&sum;
+        if (std::isinf(fsum))
+        {
+            // Overflow: the exact sum must be at the border or outside of the range of a float
+            REQUIRE(std::fabs(exact) + std::ldexp((long double)maxOperand, -(23 + 3 - 1)) >= (long double)FLT_MAX);
+            continue;
+        }
+        // ulp of the sum, denormalized numbers have the same ulp as numbers with an exponent of 1
+        const uint32_t exponent = std::max<uint32_t>((sum >> 23) & 0xff, 1);
+        const long double ulp = std::ldexp(1.0L, (int)exponent - 127 - 23);
+        const long double bound = std::ldexp((long double)maxOperand, -(23 + 3 - 1)) + (ulp / 2.0L);
+        REQUIRE(std::fabs((long double)fsum - exact) <= bound);
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatAdd3]")
+{
+    VFloatAdd3* top = new VFloatAdd3 { new VerilatedContext };
+
+    float a = 1;
+    float b = 2;
+    float c = 4;
+    float result = 7;
+    uint32_t u32Result = *(uint32_t*)&result;
+
+    top->aIn = *(uint32_t*)&a;
+    top->bIn = *(uint32_t*)&b;
+    top->cIn = *(uint32_t*)&c;
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->sum != u32Result);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->sum != u32Result);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->sum != u32Result);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->sum != u32Result);
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->sum != u32Result);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->sum == u32Result);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatAdd3]")
+{
+    VFloatAdd3* top = new VFloatAdd3 { new VerilatedContext };
+    top->ce = 1;
+
+    // 0 + 0 + 0 = 0
+    testAdd3(top, 0x0, 0x0, 0x0, 0x0);
+
+    // 1 + 2 + 3 = 6
+    testAdd3(top, 0x3f800000, 0x40000000, 0x40400000, 0x40c00000);
+
+    // 1 + -1 + 0.5 = 0.5 (cancellation)
+    testAdd3(top, 0x3f800000, 0xbf800000, 0x3f000000, 0x3f000000);
+
+    // 1 + -1 + 0 = 0
+    testAdd3(top, 0x3f800000, 0xbf800000, 0x0, 0x0);
+
+    // 1 + -1 + 9.3E-10 = 0 (2^-30 is shifted out behind the guard bits)
+    testAdd3(top, 0x3f800000, 0xbf800000, 0x30800000, 0x0);
+
+    // 1.4E-45 + 1.4E-45 + 1.4E-45 = 4.2E-45 (denormalized numbers)
+    testAdd3(top, 0x1, 0x1, 0x1, 0x3);
+
+    // 1.1754942E-38 + 1.4E-45 + 0 = 1.17549435E-38 (denormalized to normalized)
+    testAdd3(top, 0x007fffff, 0x1, 0x0, 0x00800000);
+
+    // 1.17549435E-38 - 1.4E-45 - 1.4E-45 = 1.1754941E-38 (normalized to denormalized)
+    testAdd3(top, 0x00800000, 0x80000001, 0x80000001, 0x007ffffe);
+
+    // 3.4028235E38 + 3.4028235E38 + 0 = Inf
+    testAdd3(top, 0x7f7fffff, 0x7f7fffff, 0x0, 0x7f800000);
+
+    // -3.4028235E38 - 3.4028235E38 - 3.4028235E38 = -Inf
+    testAdd3(top, 0xff7fffff, 0xff7fffff, 0xff7fffff, 0xff800000);
+
+    // Inf + 1 + 1 = Inf
+    testAdd3(top, 0x7f800000, 0x3f800000, 0x3f800000, 0x7f800000);
+
+    // 1 + NaN + 1 = NaN
+    testAdd3(top, 0x3f800000, 0x7fc00000, 0x3f800000, 0x7fffffff);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,130 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatAddSubTest.h"
+
+void clk(VFloatAddSubTest* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+uint32_t randomOperand(std::mt19937& rng)
+{
+    // Mix completely random bit patterns (inf, denormals, ...) with numbers with close exponents,
+    // which are the interesting cases for the alignment and the normalization
+    return (rng() & 1) ? rng() : ((rng() & 0x807fffff) | ((0x78 + (rng() % 0x10)) << 23));
+}
+
+void runTest(VFloatAddSubTest* top, std::mt19937& rng, bool randomCe)
+{
+    // Fill the pipeline before the results are compared
+    int pipelineCounter = 4;
+    for (uint32_t i = 0; i < 2000000; i++)
+    {
+        top->ce = randomCe ? ((rng() % 4) != 0) : 1;
+        top->aIn = randomOperand(rng);
+        top->bIn = (rng() % 8) ? randomOperand(rng) : top->aIn; // Also check a - a
+        clk(top);
+
+        if (pipelineCounter == 0)
+        {
+            REQUIRE(top->sum == top->refSum);
+            REQUIRE(top->diff == top->refDiff);
+        }
+        else if (top->ce)
+        {
+            pipelineCounter--;
+        }
+    }
+}
+
+TEST_CASE("Bit exact to FloatAdd and FloatSub", "[FloatAddSub]")
+{
+    VFloatAddSubTest* top = new VFloatAddSubTest { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+
+    runTest(top, rng, false);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatAddSub]")
+{
+    VFloatAddSubTest* top = new VFloatAddSubTest { new VerilatedContext };
+    std::mt19937 rng { 4321 };
+
+    runTest(top, rng, true);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Butterfly of small integers", "[FloatAddSub]")
+{
+    VFloatAddSubTest* top = new VFloatAddSubTest { new VerilatedContext };
+    top->ce = 1;
+
+    for (int a = -50; a <= 50; a++)
+    {
+        for (int b = -50; b <= 50; b++)
+        {
+            const float fa = a;
+            const float fb = b;
+            const float fSum = fa + fb;
+            const float fDiff = fa - fb;
+            top->aIn = *(uint32_t*)&fa;
+            top->bIn = *(uint32_t*)&fb;
+            // The pipeline has a latency of 4 clocks until the result is computed.
+            clk(top);
+            clk(top);
+            clk(top);
+            clk(top);
+            // The sum and the difference of integers are exact, only the sign of a zero can differ
+            REQUIRE((top->sum & 0x7fffffff) == (*(uint32_t*)&fSum & 0x7fffffff));
+            REQUIRE((top->diff & 0x7fffffff) == (*(uint32_t*)&fDiff & 0x7fffffff));
+            if (fSum != 0.0f)
+                REQUIRE(top->sum == *(uint32_t*)&fSum);
+            if (fDiff != 0.0f)
+                REQUIRE(top->diff == *(uint32_t*)&fDiff);
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
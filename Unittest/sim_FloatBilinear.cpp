@@ -0,0 +1,245 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatBilinear.h"
+
+// The channels, the fraction size and the multiplier delay are configured via the Makefile
+#ifndef TEST_CHANNELS
+#define TEST_CHANNELS 4
+#endif
+#ifndef TEST_FRACTION_SIZE
+#define TEST_FRACTION_SIZE 8
+#endif
+#ifndef TEST_MUL_DELAY
+#define TEST_MUL_DELAY 0
+#endif
+static constexpr uint32_t LATENCY = 4 + (2 * (9 + TEST_MUL_DELAY));
+
+void clk(VFloatBilinear* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+template <typename T>
+void setWord(T& port, uint32_t index, uint32_t value)
+{
+    port[index] = value;
+}
+
+void setWord(uint32_t& port, uint32_t, uint32_t value)
+{
+    port = value;
+}
+
+template <typename T>
+uint32_t getWord(const T& port, uint32_t index)
+{
+    return port[index];
+}
+
+uint32_t getWord(const uint32_t& port, uint32_t)
+{
+    return port;
+}
+
+struct Sample
+{
+    float texels[4][TEST_CHANNELS]; // 00, 10, 01, 11
+    uint32_t x;
+    uint32_t y;
+};
+
+using Pixel = std::array<uint32_t, TEST_CHANNELS>;
+
+// Every lerp is rounded once, its truncation error is relative to the magnitude of its operands
+// (see sim_FloatLerp.cpp). The error of the horizontal lerps is weighted with (1 - y) and y.
+void checkPixel(const Sample& s, const Pixel& out, double& maxError)
+{
+    const double x = std::ldexp((double)s.x, -TEST_FRACTION_SIZE);
+    const double y = std::ldexp((double)s.y, -TEST_FRACTION_SIZE);
+    for (uint32_t c = 0; c < TEST_CHANNELS; c++)
+    {
+        auto lerp = [](double a, double b, double t) { return a + (t * (b - a)); };
+        auto lerpBound = [](double a, double b, double r) {
+            return (std::fabs(r) * std::ldexp(1.0, -24)) + ((std::fabs(a) + std::fabs(b)) * std::ldexp(1.0, -23));
+        };
+        const double top = lerp(s.texels[0][c], s.texels[1][c], x);
+        const double bottom = lerp(s.texels[2][c], s.texels[3][c], x);
+        const double reference = lerp(top, bottom, y);
+        const double bound = lerpBound(top, bottom, reference)
+            + std::fmax(lerpBound(s.texels[0][c], s.texels[1][c], top), lerpBound(s.texels[2][c], s.texels[3][c], bottom));
+        const double error = std::fabs((double)toFloat(out[c]) - reference);
+        REQUIRE(error <= bound);
+        maxError = std::fmax(maxError, (bound > 0.0) ? error / bound : 0.0);
+    }
+}
+
+// ceRate is the probability in percent that ce is set
+std::vector<Pixel> runFilter(VFloatBilinear* top, const std::vector<Sample>& samples, uint32_t ceRate, std::mt19937& rng)
+{
+    std::vector<Pixel> results;
+    uint32_t sent = 0;
+    while (results.size() < samples.size())
+    {
+        const Sample& s = samples[(sent < samples.size()) ? sent : 0];
+        top->ce = (rng() % 100) < ceRate;
+        for (uint32_t c = 0; c < TEST_CHANNELS; c++)
+        {
+            setWord(top->texel00, c, toUint(s.texels[0][c]));
+            setWord(top->texel10, c, toUint(s.texels[1][c]));
+            setWord(top->texel01, c, toUint(s.texels[2][c]));
+            setWord(top->texel11, c, toUint(s.texels[3][c]));
+        }
+        top->x = s.x;
+        top->y = s.y;
+        top->eval();
+        if (top->ce)
+        {
+            if (sent >= LATENCY)
+            {
+                Pixel p;
+                for (uint32_t c = 0; c < TEST_CHANNELS; c++)
+                    p[c] = getWord(top->out, c);
+                results.push_back(p);
+            }
+            sent++;
+        }
+        clk(top);
+    }
+    return results;
+}
+
+// Texels of a HDR texture in 0 .. 16
+std::vector<Sample> randomSamples(std::mt19937& rng, uint32_t count)
+{
+    std::uniform_real_distribution<float> texel { 0.0f, 16.0f };
+    std::vector<Sample> samples(count);
+    for (Sample& s : samples)
+    {
+        for (uint32_t t = 0; t < 4; t++)
+            for (uint32_t c = 0; c < TEST_CHANNELS; c++)
+                s.texels[t][c] = texel(rng);
+        s.x = rng() & ((1 << TEST_FRACTION_SIZE) - 1);
+        s.y = rng() & ((1 << TEST_FRACTION_SIZE) - 1);
+    }
+    return samples;
+}
+
+TEST_CASE("Random texels", "[FloatBilinear]")
+{
+    VFloatBilinear* top = new VFloatBilinear { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    const std::vector<Sample> samples = randomSamples(rng, 200000);
+
+    double maxError = 0.0;
+    const std::vector<Pixel> results = runFilter(top, samples, 100, rng);
+    for (uint32_t i = 0; i < samples.size(); i++)
+        checkPixel(samples[i], results[i], maxError);
+    std::printf("FloatBilinear (CHANNELS = %d, FRACTION_SIZE = %d): Max error %f of the bound\n", TEST_CHANNELS, TEST_FRACTION_SIZE, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatBilinear]")
+{
+    VFloatBilinear* top = new VFloatBilinear { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+
+    // Texel 00 with x = y = 0, the center of the four texels and a constant texture
+    std::vector<Sample> samples(3);
+    for (uint32_t c = 0; c < TEST_CHANNELS; c++)
+    {
+        samples[0].texels[0][c] = 0.75f + c;
+        samples[0].texels[1][c] = 100.0f;
+        samples[0].texels[2][c] = -3.0f;
+        samples[0].texels[3][c] = 7.0f;
+        samples[1].texels[0][c] = 0.0f;
+        samples[1].texels[1][c] = 1.0f;
+        samples[1].texels[2][c] = 2.0f;
+        samples[1].texels[3][c] = 3.0f + c;
+        for (uint32_t t = 0; t < 4; t++)
+            samples[2].texels[t][c] = 0.1f;
+    }
+    samples[0].x = 0;
+    samples[0].y = 0;
+    samples[1].x = 1 << (TEST_FRACTION_SIZE - 1);
+    samples[1].y = 1 << (TEST_FRACTION_SIZE - 1);
+    samples[2].x = 3;
+    samples[2].y = (1 << TEST_FRACTION_SIZE) - 1;
+    const std::vector<Pixel> results = runFilter(top, samples, 100, rng);
+    for (uint32_t c = 0; c < TEST_CHANNELS; c++)
+    {
+        REQUIRE(toFloat(results[0][c]) == 0.75f + c);
+        REQUIRE(toFloat(results[1][c]) == (6.0f + c) / 4.0f);
+        REQUIRE(toFloat(results[2][c]) == 0.1f);
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatBilinear]")
+{
+    VFloatBilinear* top = new VFloatBilinear { new VerilatedContext };
+    VFloatBilinear* stalled = new VFloatBilinear { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    const std::vector<Sample> samples = randomSamples(rng, 2000);
+
+    // The results are bit exact to the results without stalls
+    const std::vector<Pixel> results = runFilter(top, samples, 100, rng);
+    REQUIRE(runFilter(stalled, samples, 60, rng) == results);
+
+    // Final model cleanup
+    top->final();
+    stalled->final();
+
+    // Destroy model
+    delete top;
+    delete stalled;
+}
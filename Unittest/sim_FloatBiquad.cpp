@@ -0,0 +1,195 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatBiquad.h"
+
+// The number of channels and sections is configured via the Makefile.
+// The coefficients { b0, b1, b2, a1, a2 } must match the COEFFICIENTS in the Makefile.
+#ifndef TEST_CHANNELS
+#define TEST_CHANNELS 8
+#endif
+#ifndef TEST_SECTIONS
+#define TEST_SECTIONS 1
+#endif
+static const double COEFFICIENTS[3][5] = {
+    { 0.25, 0.5, 0.25, -0.5, 0.25 }, // Low pass (default)
+    { 0.5, 0.0, -0.5, -1.25, 0.5625 }, // Band pass
+    { 1.0, -1.5, 0.5, 0.75, 0.125 } // High pass
+};
+static constexpr uint32_t MUL_DELAY = 2;
+static constexpr uint32_t LATENCY = TEST_SECTIONS * (2 + MUL_DELAY + 8);
+
+void clk(VFloatBiquad* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+// Cascade of biquads for one channel
+struct Reference
+{
+    double state[TEST_SECTIONS][4] {}; // x[n - 1], x[n - 2], y[n - 1], y[n - 2]
+
+    double filter(double x)
+    {
+        for (uint32_t s = 0; s < TEST_SECTIONS; s++)
+        {
+            const double* c = COEFFICIENTS[s];
+            double* z = state[s];
+            const double y = (c[0] * x) + (c[1] * z[0]) + (c[2] * z[1]) - (c[3] * z[2]) - (c[4] * z[3]);
+            z[1] = z[0];
+            z[0] = x;
+            z[3] = z[2];
+            z[2] = y;
+            x = y;
+        }
+        return x;
+    }
+};
+
+// Streams the samples (sample n of channel c at (n * TEST_CHANNELS) + c) through the filter.
+// ceRate is the probability in percent that ce is set.
+std::vector<uint32_t> runFilter(VFloatBiquad* top, const std::vector<float>& samples, uint32_t ceRate, std::mt19937& rng)
+{
+    std::vector<uint32_t> results;
+    uint32_t sent = 0;
+    while (results.size() < samples.size())
+    {
+        top->ce = (rng() % 100) < ceRate;
+        top->x = toUint((sent < samples.size()) ? samples[sent] : 0.0f);
+        top->eval();
+        if (top->ce)
+        {
+            if (sent >= LATENCY)
+                results.push_back(top->y);
+            sent++;
+        }
+        clk(top);
+    }
+    return results;
+}
+
+// The rounding errors are amplified by the feedback. The filters have a small gain, so the
+// errors stay in the range of a few ulp of the input.
+void checkFilter(const std::vector<float>& samples, const std::vector<uint32_t>& results, double& maxError)
+{
+    Reference references[TEST_CHANNELS];
+    for (uint32_t i = 0; i < results.size(); i++)
+    {
+        const double reference = references[i % TEST_CHANNELS].filter(samples[i]);
+        const double error = std::fabs((double)toFloat(results[i]) - reference);
+        const double bound = std::ldexp(1.0, -18);
+        REQUIRE(error <= bound);
+        maxError = std::fmax(maxError, error / bound);
+    }
+}
+
+TEST_CASE("Random samples", "[FloatBiquad]")
+{
+    VFloatBiquad* top = new VFloatBiquad { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    std::vector<float> samples(TEST_CHANNELS * 20000);
+    for (float& x : samples)
+        x = dist(rng);
+
+    double maxError = 0.0;
+    checkFilter(samples, runFilter(top, samples, 100, rng), maxError);
+    std::printf("FloatBiquad (CHANNELS = %d, SECTIONS = %d): Max error %f of the bound\n", TEST_CHANNELS, TEST_SECTIONS, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatBiquad]")
+{
+    VFloatBiquad* top = new VFloatBiquad { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+
+    // Impulse in channel 2, the channels are independent
+    std::vector<float> samples(TEST_CHANNELS * 100, 0.0f);
+    samples[2] = 1.0f;
+    const std::vector<uint32_t> results = runFilter(top, samples, 100, rng);
+    double maxError = 0.0;
+    checkFilter(samples, results, maxError);
+    for (uint32_t i = 0; i < results.size(); i++)
+    {
+        if ((i % TEST_CHANNELS) != 2)
+            REQUIRE(toFloat(results[i]) == 0.0f);
+    }
+    // The first value of the impulse response is the product of all b0
+    double b0 = 1.0;
+    for (uint32_t s = 0; s < TEST_SECTIONS; s++)
+        b0 *= COEFFICIENTS[s][0];
+    REQUIRE(toFloat(results[2]) == (float)b0);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatBiquad]")
+{
+    VFloatBiquad* top = new VFloatBiquad { new VerilatedContext };
+    VFloatBiquad* stalled = new VFloatBiquad { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    std::vector<float> samples(TEST_CHANNELS * 200);
+    for (float& x : samples)
+        x = dist(rng);
+
+    // The results are bit exact to the results without stalls
+    const std::vector<uint32_t> results = runFilter(top, samples, 100, rng);
+    REQUIRE(runFilter(stalled, samples, 60, rng) == results);
+
+    // Final model cleanup
+    top->final();
+    stalled->final();
+
+    // Destroy model
+    delete top;
+    delete stalled;
+}
@@ -0,0 +1,201 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cfenv>
+#include <cmath>
+#include <deque>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatCdc.h"
+
+// The module is verilated with OPERATION = "MUL" and PORTS = 2 (see Makefile)
+static constexpr uint32_t PORTS = 2;
+static constexpr uint32_t BUS_PERIOD = 10; // 100 MHz
+static constexpr uint32_t CALC_PERIOD = 4; // 250 MHz
+
+// The FloatMul truncates the result
+uint32_t referenceMul(uint32_t a, uint32_t b)
+{
+    const int round = std::fegetround();
+    std::fesetround(FE_TOWARDZERO);
+    const float fa = *(float*)&a;
+    const float fb = *(float*)&b;
+    // The product of two floats is exact in a double
+    volatile double prod = (double)fa * (double)fb;
+    float result = (float)prod;
+    std::fesetround(round);
+    return *(uint32_t*)&result;
+}
+
+uint32_t randomFloat(std::mt19937& rng)
+{
+    // Keep the exponent in a range where the product is a normalized number
+    std::uniform_int_distribution<int> exponent { -30, 30 };
+    float f = std::ldexp(1.0f + (float)(rng() & 0x7fffff) / (float)0x800000, exponent(rng));
+    if (rng() & 1)
+        f = -f;
+    return *(uint32_t*)&f;
+}
+
+struct Port
+{
+    std::deque<uint32_t> expected {};
+    uint32_t a { 0 };
+    uint32_t b { 0 };
+    uint32_t sent { 0 };
+    uint32_t received { 0 };
+};
+
+// Drives both clocks independently. Before every rising edge of busClk,
+// the handshakes are evaluated and new operands are applied after the edge.
+void runTest(VFloatCdc* top, std::mt19937& rng, uint32_t valuesPerPort, uint32_t validRate, uint32_t readyRate)
+{
+    Port ports[PORTS];
+    uint64_t time = 0;
+
+    auto applyOperands = [&]() {
+        top->inValid = 0;
+        top->outReady = 0;
+        for (uint32_t p = 0; p < PORTS; p++)
+        {
+            const bool valid = (ports[p].sent < valuesPerPort) && ((rng() % 100) < validRate);
+            top->inValid |= valid << p;
+            top->outReady |= ((rng() % 100) < readyRate) << p;
+            top->aIn = (top->aIn & ~(0xffffffffull << (p * 32))) | ((uint64_t)ports[p].a << (p * 32));
+            top->bIn = (top->bIn & ~(0xffffffffull << (p * 32))) | ((uint64_t)ports[p].b << (p * 32));
+        }
+    };
+
+    for (uint32_t p = 0; p < PORTS; p++)
+    {
+        ports[p].a = randomFloat(rng);
+        ports[p].b = randomFloat(rng);
+    }
+    applyOperands();
+
+    bool finished = false;
+    while (!finished)
+    {
+        REQUIRE(time < 10000000);
+        time++;
+
+        if ((time % BUS_PERIOD) == 0)
+        {
+            top->busClk = 0;
+            top->eval();
+            // Handshakes are sampled with the rising edge
+            for (uint32_t p = 0; p < PORTS; p++)
+            {
+                if (((top->inValid >> p) & 1) && ((top->inReady >> p) & 1))
+                {
+                    ports[p].expected.push_back(referenceMul(ports[p].a, ports[p].b));
+                    ports[p].sent++;
+                    ports[p].a = randomFloat(rng);
+                    ports[p].b = randomFloat(rng);
+                }
+                if (((top->outValid >> p) & 1) && ((top->outReady >> p) & 1))
+                {
+                    REQUIRE(!ports[p].expected.empty());
+                    REQUIRE((uint32_t)(top->out >> (p * 32)) == ports[p].expected.front());
+                    ports[p].expected.pop_front();
+                    ports[p].received++;
+                }
+            }
+            top->busClk = 1;
+            top->eval();
+            applyOperands();
+            top->eval();
+        }
+        else if ((time % BUS_PERIOD) == (BUS_PERIOD / 2))
+        {
+            top->busClk = 0;
+            top->eval();
+        }
+
+        if ((time % CALC_PERIOD) == 0)
+        {
+            top->calcClk = 1;
+            top->eval();
+        }
+        else if ((time % CALC_PERIOD) == (CALC_PERIOD / 2))
+        {
+            top->calcClk = 0;
+            top->eval();
+        }
+
+        finished = true;
+        for (uint32_t p = 0; p < PORTS; p++)
+        {
+            finished = finished && (ports[p].received == valuesPerPort);
+        }
+    }
+}
+
+void reset(VFloatCdc* top)
+{
+    top->busResetn = 0;
+    top->calcResetn = 0;
+    for (uint32_t i = 0; i < 40; i++)
+    {
+        top->busClk = (i >> 1) & 1;
+        top->calcClk = i & 1;
+        top->eval();
+    }
+    top->busResetn = 1;
+    top->calcResetn = 1;
+    top->busClk = 0;
+    top->calcClk = 0;
+    top->eval();
+}
+
+TEST_CASE("Stream with full throughput", "[FloatCdc]")
+{
+    VFloatCdc* top = new VFloatCdc { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    reset(top);
+
+    runTest(top, rng, 100000, 100, 100);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Backpressure and gaps", "[FloatCdc]")
+{
+    VFloatCdc* top = new VFloatCdc { new VerilatedContext };
+    std::mt19937 rng { 4321 };
+    reset(top);
+
+    runTest(top, rng, 20000, 70, 30);
+    runTest(top, rng, 20000, 30, 90);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,184 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatCompare.h"
+
+// The module is verilated with half precision floats (see Makefile)
+static constexpr uint32_t MODE_MIN = 0;
+static constexpr uint32_t MODE_MAX = 1;
+static constexpr uint32_t MODE_CLAMP = 2;
+
+void clk(VFloatCompare* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float halfToFloat(uint32_t h)
+{
+    const uint32_t exponent = (h >> 10) & 0x1f;
+    const uint32_t mantissa = h & 0x3ff;
+    float f;
+    if (exponent == 0)
+        f = std::ldexp((float)mantissa, -24);
+    else if (exponent == 0x1f)
+        f = (mantissa == 0) ? INFINITY : NAN;
+    else
+        f = std::ldexp((float)(mantissa | 0x400), (int)exponent - 25);
+    return (h & 0x8000) ? -f : f;
+}
+
+std::vector<float> allHalfs()
+{
+    std::vector<float> halfs(0x10000);
+    for (uint32_t i = 0; i < 0x10000; i++)
+    {
+        halfs[i] = halfToFloat(i);
+    }
+    return halfs;
+}
+
+TEST_CASE("Exhaustive compare, min and max", "[FloatCompare]")
+{
+    VFloatCompare* top = new VFloatCompare { new VerilatedContext };
+    const std::vector<float> halfs = allHalfs();
+    top->ce = 1;
+    top->cIn = 0;
+
+    for (uint32_t a = 0; a < 0x10000; a++)
+    {
+        for (uint32_t b = 0; b < 0x10000; b++)
+        {
+            const uint32_t mode = (b & 1) ? MODE_MAX : MODE_MIN;
+            top->aIn = a;
+            top->bIn = b;
+            top->mode = mode;
+            clk(top);
+
+            const float fa = halfs[a];
+            const float fb = halfs[b];
+            // NaNs are not handled
+            if (std::isnan(fa) || std::isnan(fb))
+                continue;
+
+            REQUIRE(top->lt == (fa < fb));
+            REQUIRE(top->eq == (fa == fb));
+            REQUIRE(top->gt == (fa > fb));
+            if (mode == MODE_MIN)
+                REQUIRE(top->out == ((fa < fb) ? a : b));
+            else
+                REQUIRE(top->out == ((fa > fb) ? a : b));
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Exhaustive clamp", "[FloatCompare]")
+{
+    VFloatCompare* top = new VFloatCompare { new VerilatedContext };
+    const std::vector<float> halfs = allHalfs();
+    std::mt19937 rng { 1234 };
+    top->ce = 1;
+    top->mode = MODE_CLAMP;
+
+    // Bounds: -0 .. +0, -Inf .. Inf, 0 .. 1 and random bounds
+    std::vector<std::pair<uint32_t, uint32_t>> bounds { { 0x8000, 0x0000 }, { 0xfc00, 0x7c00 }, { 0x0000, 0x3c00 } };
+    while (bounds.size() < 64)
+    {
+        const uint32_t lo = rng() & 0xffff;
+        const uint32_t hi = rng() & 0xffff;
+        if (std::isnan(halfs[lo]) || std::isnan(halfs[hi]))
+            continue;
+        if (halfs[lo] <= halfs[hi])
+            bounds.push_back({ lo, hi });
+        else
+            bounds.push_back({ hi, lo });
+    }
+
+    for (const auto& [lo, hi] : bounds)
+    {
+        for (uint32_t a = 0; a < 0x10000; a++)
+        {
+            top->aIn = a;
+            top->bIn = lo;
+            top->cIn = hi;
+            clk(top);
+
+            const float fa = halfs[a];
+            if (std::isnan(fa))
+                continue;
+
+            const uint32_t expected = (fa < halfs[lo]) ? lo : ((fa > halfs[hi]) ? hi : a);
+            REQUIRE(top->out == expected);
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatCompare]")
+{
+    VFloatCompare* top = new VFloatCompare { new VerilatedContext };
+
+    top->mode = MODE_MIN;
+    top->aIn = 0x3c00; // 1.0
+    top->bIn = 0x4000; // 2.0
+    top->cIn = 0;
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->out == 0x3c00);
+    REQUIRE(top->lt == 1);
+
+    top->mode = MODE_MAX;
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->out == 0x3c00);
+    REQUIRE(top->lt == 1);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->out == 0x4000);
+    REQUIRE(top->lt == 1);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,197 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatComplexMul.h"
+
+// The MUL_DELAY is configured via the Makefile
+#ifndef TEST_MUL_DELAY
+#define TEST_MUL_DELAY 2
+#endif
+static constexpr uint32_t LATENCY = 10 + TEST_MUL_DELAY;
+
+struct Complex
+{
+    uint32_t re;
+    uint32_t im;
+};
+
+void clk(VFloatComplexMul* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+uint32_t randomFloat(std::mt19937& rng)
+{
+    // Keep the exponent in a range where the products are normalized numbers
+    std::uniform_int_distribution<int> exponent { -20, 20 };
+    float f = std::ldexp(1.0f + (float)(rng() & 0x7fffff) / (float)0x800000, exponent(rng));
+    if (rng() & 1)
+        f = -f;
+    return toUint(f);
+}
+
+// Every k has an error of 1.5 ulp (rounding of the pre-addition and truncation of the
+// FloatMul). Because of the cancellation in the post-addition, the error is bound by
+// (|aRe| + |aIm|) * (|bRe| + |bIm|) and not by the magnitude of the result.
+void checkComplexMul(const Complex& a, const Complex& b, const Complex& out, double& maxError)
+{
+    const double aRe = toFloat(a.re);
+    const double aIm = toFloat(a.im);
+    const double bRe = toFloat(b.re);
+    const double bIm = toFloat(b.im);
+    // The products of two floats are exact in a double
+    const double re = (aRe * bRe) - (aIm * bIm);
+    const double im = (aRe * bIm) + (aIm * bRe);
+    const double bound = 4.0 * (std::fabs(aRe) + std::fabs(aIm)) * (std::fabs(bRe) + std::fabs(bIm)) * std::ldexp(1.0, -23);
+    const double error = std::fmax(std::fabs((double)toFloat(out.re) - re), std::fabs((double)toFloat(out.im) - im));
+    REQUIRE(error <= bound);
+    maxError = std::fmax(maxError, error / bound);
+}
+
+void apply(VFloatComplexMul* top, const Complex& a, const Complex& b)
+{
+    top->aRe = a.re;
+    top->aIm = a.im;
+    top->bRe = b.re;
+    top->bIm = b.im;
+}
+
+Complex calcComplexMul(VFloatComplexMul* top, const Complex& a, const Complex& b)
+{
+    apply(top, a, b);
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return { top->re, top->im };
+}
+
+TEST_CASE("Random numbers", "[FloatComplexMul]")
+{
+    VFloatComplexMul* top = new VFloatComplexMul { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::deque<std::pair<Complex, Complex>> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        const Complex a { randomFloat(rng), randomFloat(rng) };
+        Complex b { randomFloat(rng), randomFloat(rng) };
+        if (i & 1)
+        {
+            // Operands with a similar magnitude, to provoke cancellations
+            b = { a.im ^ (uint32_t)(rng() & 0x800000ff), a.re ^ (uint32_t)(rng() & 0x800000ff) };
+        }
+        apply(top, a, b);
+        history.push_back({ a, b });
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkComplexMul(history.front().first, history.front().second, { top->re, top->im }, maxError);
+            history.pop_front();
+        }
+    }
+    std::printf("FloatComplexMul (MUL_DELAY = %d): Max error %f of the bound\n", TEST_MUL_DELAY, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatComplexMul]")
+{
+    VFloatComplexMul* top = new VFloatComplexMul { new VerilatedContext };
+    top->ce = 1;
+
+    // (1 + 2i) * (3 + 4i) = -5 + 10i
+    Complex out = calcComplexMul(top, { toUint(1.0f), toUint(2.0f) }, { toUint(3.0f), toUint(4.0f) });
+    REQUIRE(out.re == toUint(-5.0f));
+    REQUIRE(out.im == toUint(10.0f));
+
+    // i * i = -1
+    out = calcComplexMul(top, { toUint(0.0f), toUint(1.0f) }, { toUint(0.0f), toUint(1.0f) });
+    REQUIRE(out.re == toUint(-1.0f));
+    REQUIRE(toFloat(out.im) == 0.0f);
+
+    // (1.5 - 0.25i) * 2 = 3 - 0.5i
+    out = calcComplexMul(top, { toUint(1.5f), toUint(-0.25f) }, { toUint(2.0f), toUint(0.0f) });
+    REQUIRE(out.re == toUint(3.0f));
+    REQUIRE(out.im == toUint(-0.5f));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatComplexMul]")
+{
+    VFloatComplexMul* top = new VFloatComplexMul { new VerilatedContext };
+    top->ce = 1;
+
+    // Clear the pipeline with 1 * 1 = 1
+    calcComplexMul(top, { toUint(1.0f), toUint(0.0f) }, { toUint(1.0f), toUint(0.0f) });
+
+    apply(top, { toUint(1.0f), toUint(2.0f) }, { toUint(3.0f), toUint(4.0f) });
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->re == toUint(1.0f));
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->re == toUint(1.0f));
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->re == toUint(-5.0f));
+    REQUIRE(top->im == toUint(10.0f));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,375 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatCordic.h"
+
+// The mode and the number of iterations are configured via the Makefile.
+// Define TEST_ROTATION for MODE = "ROTATION".
+#ifndef TEST_ITERATIONS
+#define TEST_ITERATIONS 25
+#endif
+static constexpr uint32_t LATENCY = TEST_ITERATIONS + 10;
+static constexpr double MAX_ULP_ERROR = 1.0;
+// Every iteration adds roughly one bit of accuracy
+static const double MAX_ABS_ERROR = std::ldexp(1.0, -std::min(TEST_ITERATIONS - 2, 21));
+
+void clk(VFloatCordic* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+uint32_t randomFloat(std::mt19937& rng)
+{
+    std::uniform_int_distribution<int> exponent { -20, 20 };
+    float f = std::ldexp(1.0f + (float)(rng() & 0x7fffff) / (float)0x800000, exponent(rng));
+    if (rng() & 1)
+        f = -f;
+    return toUint(f);
+}
+
+struct Input
+{
+    uint32_t x;
+    uint32_t y;
+    uint32_t angle;
+};
+
+struct Result
+{
+    uint32_t x;
+    uint32_t y;
+    uint32_t angle;
+};
+
+Result calcCordic(VFloatCordic* top, const Input& in)
+{
+    top->xIn = in.x;
+    top->yIn = in.y;
+    top->angleIn = in.angle;
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return { top->xOut, top->yOut, top->angleOut };
+}
+
+#ifndef TEST_ROTATION
+void checkVectoring(const Input& in, const Result& out, double& maxUlpError, double& maxAngleError)
+{
+    const double x = toFloat(in.x);
+    const double y = toFloat(in.y);
+    const double magnitude = std::hypot(x, y);
+    const double ulp = std::ldexp(1.0, std::ilogb(magnitude) - 23);
+    const double ulpError = std::fabs((double)toFloat(out.x) - magnitude) / ulp;
+    const double angleError = std::fabs((double)toFloat(out.angle) - std::atan2(y, x));
+    REQUIRE(ulpError < MAX_ULP_ERROR);
+    REQUIRE(angleError < MAX_ABS_ERROR);
+    maxUlpError = std::fmax(maxUlpError, ulpError);
+    maxAngleError = std::fmax(maxAngleError, angleError);
+}
+
+TEST_CASE("Random vectors", "[FloatCordic]")
+{
+    VFloatCordic* top = new VFloatCordic { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::deque<Input> history;
+    double maxUlpError = 0.0;
+    double maxAngleError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        const Input in { randomFloat(rng), randomFloat(rng), 0 };
+        top->xIn = in.x;
+        top->yIn = in.y;
+        top->angleIn = in.angle;
+        history.push_back(in);
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkVectoring(history.front(), { top->xOut, top->yOut, top->angleOut }, maxUlpError, maxAngleError);
+            history.pop_front();
+        }
+    }
+    std::printf("FloatCordic (ITERATIONS = %d): sqrt(x * x + y * y) max error %f ulp, atan2 max absolute error 2^%f\n", 
+        TEST_ITERATIONS, maxUlpError, std::log2(maxAngleError));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatCordic]")
+{
+    VFloatCordic* top = new VFloatCordic { new VerilatedContext };
+    top->ce = 1;
+    Result r;
+
+    // sqrt(3 * 3 + 4 * 4) = 5, atan2(4, 3) = 0.9273
+    r = calcCordic(top, { 0x40400000, 0x40800000, 0 });
+    REQUIRE(std::fabs(toFloat(r.x) - 5.0) <= std::ldexp(1.0, -21));
+    REQUIRE(std::fabs(toFloat(r.angle) - std::atan2(4.0, 3.0)) < MAX_ABS_ERROR);
+
+    // atan2(0, -1) = pi
+    r = calcCordic(top, { 0xbf800000, 0x00000000, 0 });
+    REQUIRE(std::fabs(toFloat(r.x) - 1.0) <= std::ldexp(1.0, -23));
+    REQUIRE(std::fabs(toFloat(r.angle) - M_PI) < MAX_ABS_ERROR);
+
+    // atan2(-1, -1) = -3 / 4 * pi
+    r = calcCordic(top, { 0xbf800000, 0xbf800000, 0 });
+    REQUIRE(std::fabs(toFloat(r.angle) + (0.75 * M_PI)) < MAX_ABS_ERROR);
+
+    // sqrt(0 * 0 + 0 * 0) = 0, atan2(0, 0) = 0
+    r = calcCordic(top, { 0x00000000, 0x00000000, 0 });
+    REQUIRE(r.x == 0x00000000);
+    REQUIRE(r.angle == 0x00000000);
+
+    // The result is bigger than the inputs: sqrt(2) * 2 ** 100
+    r = calcCordic(top, { 0x71800000, 0x71800000, 0 });
+    REQUIRE(std::fabs(toFloat(r.x) / std::ldexp(std::sqrt(2.0), 100) - 1.0) < std::ldexp(1.0, -23));
+
+    // The result overflows: sqrt(2) * 2 ** 127 = Inf
+    r = calcCordic(top, { 0x7f000000, 0x7f000000, 0 });
+    REQUIRE(r.x == 0x7f800000);
+
+    // A very small y is ignored: sqrt(1 + 2 ** -100) = 1
+    r = calcCordic(top, { 0x3f800000, 0x0d800000, 0 });
+    REQUIRE(r.x == 0x3f800000);
+    REQUIRE(std::fabs(toFloat(r.angle)) < MAX_ABS_ERROR);
+
+    // sqrt(Inf * Inf + 1) = Inf, atan2(1, Inf) = NaN
+    r = calcCordic(top, { 0x7f800000, 0x3f800000, 0 });
+    REQUIRE(r.x == 0x7f800000);
+    REQUIRE(r.angle == 0x7fffffff);
+
+    // NaN
+    r = calcCordic(top, { 0x3f800000, 0x7fc00000, 0 });
+    REQUIRE(r.x == 0x7fffffff);
+    REQUIRE(r.angle == 0x7fffffff);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatCordic]")
+{
+    VFloatCordic* top = new VFloatCordic { new VerilatedContext };
+    top->ce = 1;
+
+    // Clear the pipeline with sqrt(0 * 0 + 0 * 0) = 0
+    calcCordic(top, { 0x00000000, 0x00000000, 0 });
+
+    top->xIn = 0x3f800000; // sqrt(1 * 1 + 0 * 0)
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->xOut == 0x00000000);
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->xOut == 0x00000000);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->xOut == 0x3f800000);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+#else
+void checkRotation(const Input& in, const Result& out, double& maxError)
+{
+    const double x = toFloat(in.x);
+    const double y = toFloat(in.y);
+    const double angle = toFloat(in.angle);
+    // The error is relative to the bigger input
+    const double scale = std::ldexp(1.0, std::max(std::ilogb(x), std::ilogb(y)));
+    const double xError = std::fabs((double)toFloat(out.x) - (x * std::cos(angle) - y * std::sin(angle))) / scale;
+    const double yError = std::fabs((double)toFloat(out.y) - (x * std::sin(angle) + y * std::cos(angle))) / scale;
+    REQUIRE(xError < MAX_ABS_ERROR);
+    REQUIRE(yError < MAX_ABS_ERROR);
+    maxError = std::fmax(maxError, std::fmax(xError, yError));
+}
+
+TEST_CASE("Sweep sin and cos -pi .. pi", "[FloatCordic]")
+{
+    VFloatCordic* top = new VFloatCordic { new VerilatedContext };
+    std::deque<Input> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    const uint32_t steps = 0x200000;
+    for (uint32_t i = 0; i <= steps; i++)
+    {
+        const Input in { 0x3f800000, 0x00000000, toUint(-3.1415926f + (6.2831853f * (float)i / (float)steps)) };
+        top->xIn = in.x;
+        top->yIn = in.y;
+        top->angleIn = in.angle;
+        history.push_back(in);
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkRotation(history.front(), { top->xOut, top->yOut, top->angleOut }, maxError);
+            history.pop_front();
+        }
+    }
+    std::printf("FloatCordic (ITERATIONS = %d): sin and cos max absolute error 2^%f\n", 
+        TEST_ITERATIONS, std::log2(maxError));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Random rotations", "[FloatCordic]")
+{
+    VFloatCordic* top = new VFloatCordic { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::uniform_real_distribution<float> angle { -3.1415926f, 3.1415926f };
+    std::deque<Input> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        const Input in { randomFloat(rng), randomFloat(rng), toUint(angle(rng)) };
+        top->xIn = in.x;
+        top->yIn = in.y;
+        top->angleIn = in.angle;
+        history.push_back(in);
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkRotation(history.front(), { top->xOut, top->yOut, top->angleOut }, maxError);
+            history.pop_front();
+        }
+    }
+    std::printf("FloatCordic (ITERATIONS = %d): rotation max error 2^%f relative to the bigger input\n", 
+        TEST_ITERATIONS, std::log2(maxError));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatCordic]")
+{
+    VFloatCordic* top = new VFloatCordic { new VerilatedContext };
+    top->ce = 1;
+    Result r;
+
+    // Rotate (1, 0) by 0
+    r = calcCordic(top, { 0x3f800000, 0x00000000, 0x00000000 });
+    REQUIRE(std::fabs(toFloat(r.x) - 1.0) < MAX_ABS_ERROR);
+    REQUIRE(std::fabs(toFloat(r.y)) < MAX_ABS_ERROR);
+
+    // Rotate (0, 2) by pi / 2
+    r = calcCordic(top, { 0x00000000, 0x40000000, 0x3fc90fdb });
+    REQUIRE(std::fabs(toFloat(r.x) + 2.0) < 2.0 * MAX_ABS_ERROR);
+    REQUIRE(std::fabs(toFloat(r.y)) < 2.0 * MAX_ABS_ERROR);
+
+    // Rotate (0, 0) by 1
+    r = calcCordic(top, { 0x00000000, 0x00000000, 0x3f800000 });
+    REQUIRE(r.x == 0x00000000);
+    REQUIRE(r.y == 0x00000000);
+
+    // Rotate (Inf, 1) by 1
+    r = calcCordic(top, { 0x7f800000, 0x3f800000, 0x3f800000 });
+    REQUIRE(r.x == 0x7fffffff);
+    REQUIRE(r.y == 0x7fffffff);
+
+    // Rotate (1, 1) by NaN
+    r = calcCordic(top, { 0x3f800000, 0x3f800000, 0x7fc00000 });
+    REQUIRE(r.x == 0x7fffffff);
+    REQUIRE(r.y == 0x7fffffff);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatCordic]")
+{
+    VFloatCordic* top = new VFloatCordic { new VerilatedContext };
+    top->ce = 1;
+
+    // Clear the pipeline with a rotation of (0, 0)
+    calcCordic(top, { 0x00000000, 0x00000000, 0x00000000 });
+
+    // Rotate (1, 0) by 1
+    top->xIn = 0x3f800000;
+    top->angleIn = 0x3f800000;
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->xOut == 0x00000000);
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->xOut == 0x00000000);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(std::fabs(toFloat(top->xOut) - std::cos(1.0)) < MAX_ABS_ERROR);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+#endif
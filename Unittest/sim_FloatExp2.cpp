@@ -0,0 +1,188 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatExp2.h"
+
+// The degree of the polynomial is configured via the Makefile
+#ifndef TEST_DEGREE
+#define TEST_DEGREE 2
+#endif
+static constexpr uint32_t LATENCY = TEST_DEGREE + 3;
+static constexpr double MAX_ULP_ERROR = 1.0;
+
+void clk(VFloatExp2* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+// Checks the result and returns the error in ulp
+double checkExp2(uint32_t in, uint32_t out)
+{
+    const float x = toFloat(in);
+    const double reference = std::exp2((double)x);
+    if (std::isnan(x))
+    {
+        REQUIRE(out == 0x7fffffff);
+        return 0.0;
+    }
+    if (reference < FLT_MIN)
+    {
+        // Denormalized results are flushed to zero
+        REQUIRE(out == 0);
+        return 0.0;
+    }
+    if (out == 0x7f800000)
+    {
+        // Inf is only allowed, when the result is rounded up to Inf
+        REQUIRE(reference >= FLT_MAX);
+        return 0.0;
+    }
+    const double ulp = std::ldexp(1.0, std::ilogb(reference) - 23);
+    const double error = std::fabs((double)toFloat(out) - reference) / ulp;
+    REQUIRE(error < MAX_ULP_ERROR);
+    return error;
+}
+
+uint32_t calcExp2(VFloatExp2* top, uint32_t in)
+{
+    top->in = in;
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return top->out;
+}
+
+TEST_CASE("Sweep (x[-256 to 256])", "[FloatExp2]")
+{
+    VFloatExp2* top = new VFloatExp2 { new VerilatedContext };
+    std::deque<uint32_t> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t sign = 0; sign < 2; sign++)
+    {
+        for (uint32_t i = 0; i < 0x43800000; i += 0x3f)
+        {
+            top->in = i | (sign << 31);
+            history.push_back(top->in);
+            clk(top);
+            if (history.size() == LATENCY)
+            {
+                maxError = std::fmax(maxError, checkExp2(history.front(), top->out));
+                history.pop_front();
+            }
+        }
+    }
+    std::printf("FloatExp2 (DEGREE = %d): Max error %f ulp\n", TEST_DEGREE, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatExp2]")
+{
+    VFloatExp2* top = new VFloatExp2 { new VerilatedContext };
+    top->ce = 1;
+
+    // 2 ** 0 = 1
+    REQUIRE(calcExp2(top, 0x00000000) == 0x3f800000);
+
+    // 2 ** 1 = 2
+    REQUIRE(calcExp2(top, 0x3f800000) == 0x40000000);
+
+    // 2 ** -1 = 0.5
+    REQUIRE(calcExp2(top, 0xbf800000) == 0x3f000000);
+
+    // 2 ** 10 = 1024
+    REQUIRE(calcExp2(top, 0x41200000) == 0x44800000);
+
+    // 2 ** -126 = 1.17549435E-38
+    REQUIRE(calcExp2(top, 0xc2fc0000) == 0x00800000);
+
+    // 2 ** 127 = 1.7014118E38
+    REQUIRE(calcExp2(top, 0x42fe0000) == 0x7f000000);
+
+    // 2 ** 128 = Inf
+    REQUIRE(calcExp2(top, 0x43000000) == 0x7f800000);
+
+    // 2 ** -200 = 0 (flushed)
+    REQUIRE(calcExp2(top, 0xc3480000) == 0x00000000);
+
+    // 2 ** Inf = Inf
+    REQUIRE(calcExp2(top, 0x7f800000) == 0x7f800000);
+
+    // 2 ** -Inf = 0
+    REQUIRE(calcExp2(top, 0xff800000) == 0x00000000);
+
+    // 2 ** NaN = NaN
+    REQUIRE(calcExp2(top, 0x7fc00000) == 0x7fffffff);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatExp2]")
+{
+    VFloatExp2* top = new VFloatExp2 { new VerilatedContext };
+
+    top->in = 0x41200000; // 2 ** 10
+    top->ce = 1;
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->out != 0x44800000);
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->out != 0x44800000);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->out == 0x44800000);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
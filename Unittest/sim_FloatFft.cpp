@@ -0,0 +1,235 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatFft.h"
+
+// The size and the MUL_DELAY are configured via the Makefile
+#ifndef TEST_SIZE_LOG2
+#define TEST_SIZE_LOG2 6
+#endif
+#ifndef TEST_MUL_DELAY
+#define TEST_MUL_DELAY 2
+#endif
+static constexpr uint32_t SIZE = 1u << TEST_SIZE_LOG2;
+static constexpr uint32_t LATENCY = (SIZE - 1) + (TEST_SIZE_LOG2 * 5) + ((TEST_SIZE_LOG2 - 1) * (12 + TEST_MUL_DELAY));
+
+using Frame = std::vector<std::complex<float>>;
+
+void clk(VFloatFft* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+void reset(VFloatFft* top)
+{
+    top->ce = 1;
+    top->resetn = 0;
+    clk(top);
+    top->resetn = 1;
+}
+
+Frame randomFrame(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    Frame frame(SIZE);
+    for (std::complex<float>& x : frame)
+        x = { dist(rng), dist(rng) };
+    return frame;
+}
+
+uint32_t bitReverse(uint32_t value)
+{
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < TEST_SIZE_LOG2; i++)
+        result |= ((value >> i) & 1) << (TEST_SIZE_LOG2 - 1 - i);
+    return result;
+}
+
+// Streams the frames back to back into the FFT. ceRate is the probability in percent that ce is set.
+// Returns the output frames in natural order.
+std::vector<Frame> runFrames(VFloatFft* top, const std::vector<Frame>& frames, uint32_t ceRate, std::mt19937& rng)
+{
+    std::vector<Frame> results(frames.size(), Frame(SIZE));
+    const uint64_t samples = frames.size() * SIZE;
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    uint64_t clocks = 0;
+    uint64_t validClocks = 0;
+    reset(top);
+    const auto start = std::chrono::steady_clock::now();
+    while (received < samples)
+    {
+        REQUIRE(clocks < (100 * (samples + LATENCY)));
+        top->ce = (rng() % 100) < ceRate;
+        const std::complex<float> x = (sent < samples) ? frames[sent / SIZE][sent % SIZE] : 0.0f;
+        top->inRe = toUint(x.real());
+        top->inIm = toUint(x.imag());
+        top->eval();
+        if (top->ce && top->outValid)
+        {
+            // Bit reversed order
+            REQUIRE(top->outIndex == bitReverse(received % SIZE));
+            results[received / SIZE][top->outIndex] = { toFloat(top->outRe), toFloat(top->outIm) };
+            received++;
+        }
+        if (top->ce)
+            sent++;
+        if (top->outValid)
+            validClocks++;
+        clk(top);
+        clocks++;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (ceRate == 100)
+    {
+        // One sample per clock after the pipeline is filled
+        REQUIRE(validClocks == samples);
+        REQUIRE(clocks == (samples + LATENCY));
+        std::printf("FloatFft (SIZE = %d): %f samples per clock, %.0f simulated samples per second\n", 
+            SIZE, (double)samples / (double)validClocks, (double)samples / seconds);
+    }
+    return results;
+}
+
+// The error of every butterfly and twiddle multiplication is relative to the sum of the magnitudes
+// of the samples which contribute to the result. Per stage, these are all samples of the frame.
+void checkFrame(const Frame& in, const Frame& out, double& maxError, double& noise, double& signal)
+{
+    double magnitude = 0.0;
+    for (const std::complex<float>& x : in)
+        magnitude += std::abs(std::complex<double>(x));
+    const double bound = 16.0 * TEST_SIZE_LOG2 * magnitude * std::ldexp(1.0, -23);
+    for (uint32_t k = 0; k < SIZE; k++)
+    {
+        std::complex<double> reference = 0.0;
+        for (uint32_t n = 0; n < SIZE; n++)
+            reference += std::complex<double>(in[n]) * std::polar(1.0, -2.0 * M_PI * (double)((k * n) % SIZE) / (double)SIZE);
+        const double error = std::abs(std::complex<double>(out[k]) - reference);
+        REQUIRE(error <= bound);
+        maxError = std::fmax(maxError, error / bound);
+        noise += error * error;
+        signal += std::norm(reference);
+    }
+}
+
+TEST_CASE("Random frames", "[FloatFft]")
+{
+    VFloatFft* top = new VFloatFft { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::vector<Frame> frames;
+    for (uint32_t i = 0; i < std::max(4u, 16384 / SIZE); i++)
+        frames.push_back(randomFrame(rng));
+
+    const std::vector<Frame> results = runFrames(top, frames, 100, rng);
+    double maxError = 0.0;
+    double noise = 0.0;
+    double signal = 0.0;
+    for (uint32_t i = 0; i < frames.size(); i++)
+        checkFrame(frames[i], results[i], maxError, noise, signal);
+    std::printf("FloatFft (SIZE = %d): Max error %f of the bound, SNR %.1f dB\n", SIZE, maxError, 10.0 * std::log10(signal / noise));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatFft]")
+{
+    VFloatFft* top = new VFloatFft { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+
+    // Impulse, DC and an impulse with a delay of one sample
+    Frame impulse(SIZE, 0.0f);
+    impulse[0] = 1.0f;
+    const Frame dc(SIZE, 1.0f);
+    Frame shifted(SIZE, 0.0f);
+    shifted[1] = { 0.0f, 1.0f };
+    const std::vector<Frame> results = runFrames(top, { impulse, dc, shifted }, 100, rng);
+
+    for (uint32_t k = 0; k < SIZE; k++)
+    {
+        // All bins are exactly one
+        REQUIRE(results[0][k] == std::complex<float>(1.0f, 0.0f));
+        // Only the first bin is set
+        REQUIRE(results[1][k] == std::complex<float>((k == 0) ? (float)SIZE : 0.0f, 0.0f));
+        // i * exp(-2 * pi * i * k / SIZE)
+        const std::complex<double> reference = std::complex<double>(0.0, 1.0) * std::polar(1.0, -2.0 * M_PI * k / SIZE);
+        REQUIRE(std::abs(std::complex<double>(results[2][k]) - reference) <= (TEST_SIZE_LOG2 * std::ldexp(1.0, -21)));
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatFft]")
+{
+    VFloatFft* top = new VFloatFft { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::vector<Frame> frames;
+    for (uint32_t i = 0; i < 4; i++)
+        frames.push_back(randomFrame(rng));
+
+    // The results are bit exact to the results without stalls
+    const std::vector<Frame> results = runFrames(top, frames, 100, rng);
+    const std::vector<Frame> stalled = runFrames(top, frames, 60, rng);
+    for (uint32_t i = 0; i < frames.size(); i++)
+    {
+        for (uint32_t k = 0; k < SIZE; k++)
+        {
+            REQUIRE(toUint(stalled[i][k].real()) == toUint(results[i][k].real()));
+            REQUIRE(toUint(stalled[i][k].imag()) == toUint(results[i][k].imag()));
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,199 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatFir.h"
+
+// The number of taps, the folding and the coefficient mode are configured via the Makefile.
+// With TEST_RAM, random coefficients are written into the coefficient RAM. Otherwise the
+// default coefficients of the module (binomial low pass with 5 taps) are used.
+#ifndef TEST_TAPS
+#define TEST_TAPS 5
+#endif
+#ifndef TEST_SYMMETRIC
+#define TEST_SYMMETRIC 0
+#endif
+static constexpr uint32_t MUL_DELAY = 2;
+static constexpr uint32_t MULTIPLIERS = TEST_SYMMETRIC ? ((TEST_TAPS + 1) / 2) : TEST_TAPS;
+static constexpr uint32_t LATENCY = (MULTIPLIERS * 3) + 1 + 2 + MUL_DELAY + (TEST_SYMMETRIC ? 4 : 0);
+
+void clk(VFloatFir* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+std::vector<float> coefficients(VFloatFir* top)
+{
+#ifdef TEST_RAM
+    std::mt19937 rng { 4321 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    std::vector<float> h(TEST_TAPS);
+    for (uint32_t k = 0; k < TEST_TAPS; k++)
+        h[k] = (TEST_SYMMETRIC && (k >= MULTIPLIERS)) ? h[TEST_TAPS - 1 - k] : dist(rng);
+
+    top->ce = 1;
+    top->coefficientWe = 1;
+    for (uint32_t k = 0; k < MULTIPLIERS; k++)
+    {
+        top->coefficientAddr = k;
+        top->coefficientIn = toUint(h[k]);
+        clk(top);
+    }
+    top->coefficientWe = 0;
+    return h;
+#else
+    static_assert(TEST_TAPS == 5, "The default coefficients have 5 taps");
+    return { 0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f };
+#endif
+}
+
+// Clears the delay lines
+void flush(VFloatFir* top)
+{
+    top->ce = 1;
+    top->x = 0;
+    for (uint32_t i = 0; i < (LATENCY + (TEST_TAPS * 5)); i++)
+        clk(top);
+}
+
+// Streams the samples through the filter. ceRate is the probability in percent that ce is set.
+std::vector<uint32_t> runFilter(VFloatFir* top, const std::vector<float>& samples, uint32_t ceRate, std::mt19937& rng)
+{
+    std::vector<uint32_t> results;
+    uint32_t sent = 0;
+    flush(top);
+    while (results.size() < samples.size())
+    {
+        top->ce = (rng() % 100) < ceRate;
+        top->x = toUint((sent < samples.size()) ? samples[sent] : 0.0f);
+        top->eval();
+        if (top->ce)
+        {
+            if (sent >= LATENCY)
+                results.push_back(top->y);
+            sent++;
+        }
+        clk(top);
+    }
+    return results;
+}
+
+// Every product is truncated and every addition is rounded. The error of the additions
+// is relative to the partial sums, which are bound by the sum of the magnitudes.
+void checkFilter(const std::vector<float>& h, const std::vector<float>& samples, const std::vector<uint32_t>& results, double& maxError)
+{
+    for (uint32_t n = 0; n < results.size(); n++)
+    {
+        double reference = 0.0;
+        double magnitude = 0.0;
+        for (uint32_t k = 0; (k < TEST_TAPS) && (k <= n); k++)
+        {
+            reference += (double)h[k] * (double)samples[n - k];
+            magnitude += std::fabs((double)h[k] * (double)samples[n - k]);
+        }
+        const double error = std::fabs((double)toFloat(results[n]) - reference);
+        const double bound = (TEST_TAPS + 2) * magnitude * std::ldexp(1.0, -23);
+        REQUIRE(error <= bound);
+        maxError = std::fmax(maxError, (bound > 0.0) ? (error / bound) : 0.0);
+    }
+}
+
+TEST_CASE("Random samples", "[FloatFir]")
+{
+    VFloatFir* top = new VFloatFir { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    const std::vector<float> h = coefficients(top);
+    std::vector<float> samples(100000);
+    for (float& x : samples)
+        x = dist(rng);
+
+    double maxError = 0.0;
+    checkFilter(h, samples, runFilter(top, samples, 100, rng), maxError);
+    std::printf("FloatFir (TAPS = %d, SYMMETRIC = %d): Max error %f of the bound\n", TEST_TAPS, TEST_SYMMETRIC, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatFir]")
+{
+    VFloatFir* top = new VFloatFir { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    const std::vector<float> h = coefficients(top);
+
+    // The impulse response are the coefficients
+    std::vector<float> impulse(TEST_TAPS + 10, 0.0f);
+    impulse[0] = 1.0f;
+    const std::vector<uint32_t> results = runFilter(top, impulse, 100, rng);
+    for (uint32_t n = 0; n < results.size(); n++)
+        REQUIRE(toFloat(results[n]) == ((n < TEST_TAPS) ? h[n] : 0.0f));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatFir]")
+{
+    VFloatFir* top = new VFloatFir { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    coefficients(top);
+    std::vector<float> samples(1000);
+    for (float& x : samples)
+        x = dist(rng);
+
+    // The results are bit exact to the results without stalls
+    REQUIRE(runFilter(top, samples, 60, rng) == runFilter(top, samples, 100, rng));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
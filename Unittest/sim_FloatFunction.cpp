@@ -0,0 +1,199 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatFunction.h"
+
+// The function and the parameters are configured via the Makefile. The init files are
+// generated with the Tools/FloatFunctionGenerator.
+#ifndef TEST_DEGREE
+#define TEST_DEGREE 2
+#endif
+#ifndef TEST_EXPONENT_MIN
+#define TEST_EXPONENT_MIN -8
+#endif
+#ifndef TEST_ABSOLUTE_BELOW
+#define TEST_ABSOLUTE_BELOW -1000
+#endif
+static constexpr uint32_t LATENCY = TEST_DEGREE + 7;
+// The generator guarantees 1 ulp of the biggest result of a segment
+static constexpr double MAX_ULP_ERROR = 2.0;
+
+#if defined(TEST_SIGMOID)
+double reference(double x)
+{
+    return 1.0 / (1.0 + std::exp(-x));
+}
+static const char* NAME = "sigmoid";
+#elif defined(TEST_GELU)
+double reference(double x)
+{
+    return 0.5 * x * std::erfc(-x / std::sqrt(2.0));
+}
+static const char* NAME = "gelu";
+// gelu doesn't saturate for big x. Inputs at or above 2 ** SEGMENT_EXPONENT_MAX are not tested.
+#define TEST_INPUT_LIMIT 0x43000000 // 128.0
+#else
+double reference(double x)
+{
+    return std::tanh(x);
+}
+static const char* NAME = "tanh";
+#endif
+
+#ifndef TEST_INPUT_LIMIT
+#define TEST_INPUT_LIMIT 0x7f800000 // Inf, all inputs are tested
+#endif
+
+void clk(VFloatFunction* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+void checkFunction(uint32_t in, uint32_t out, double& maxError)
+{
+    const double x = toFloat(in);
+    const double expected = reference(x);
+    const double error = std::fabs((double)toFloat(out) - expected);
+    if (std::fabs(x) < std::ldexp(1.0, TEST_EXPONENT_MIN))
+    {
+        // x is used as fixed point number
+        REQUIRE(error < std::ldexp(1.0, TEST_EXPONENT_MIN - 21));
+    }
+    else
+    {
+        const int exponent = std::max(std::ilogb(std::fmax(std::fabs(expected), 1e-300)), TEST_ABSOLUTE_BELOW);
+        const double ulp = std::ldexp(1.0, exponent - 23);
+        REQUIRE((error / ulp) < MAX_ULP_ERROR);
+        maxError = std::fmax(maxError, error / ulp);
+    }
+}
+
+uint32_t calcFunction(VFloatFunction* top, uint32_t in)
+{
+    top->in = in;
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return top->out;
+}
+
+TEST_CASE("Sweep", "[FloatFunction]")
+{
+    VFloatFunction* top = new VFloatFunction { new VerilatedContext };
+    std::deque<uint32_t> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t sign : { 0x00000000u, 0x80000000u })
+    {
+        for (uint32_t i = 0; i < TEST_INPUT_LIMIT; i += 0x1f)
+        {
+            top->in = sign | i;
+            history.push_back(top->in);
+            clk(top);
+            if (history.size() == LATENCY)
+            {
+                checkFunction(history.front(), top->out, maxError);
+                history.pop_front();
+            }
+        }
+    }
+    std::printf("FloatFunction %s (DEGREE = %d): Max error %f ulp\n", NAME, TEST_DEGREE, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatFunction]")
+{
+    VFloatFunction* top = new VFloatFunction { new VerilatedContext };
+    top->ce = 1;
+
+    // f(0), f(1), f(-1)
+    for (uint32_t in : { 0x00000000u, 0x3f800000u, 0xbf800000u })
+    {
+        const double error = std::fabs((double)toFloat(calcFunction(top, in)) - reference(toFloat(in)));
+        REQUIRE(error <= std::ldexp(1.0, -23));
+    }
+
+    // f(Inf) and f(-Inf) use the last segments
+#if TEST_INPUT_LIMIT == 0x7f800000
+    REQUIRE(std::fabs((double)toFloat(calcFunction(top, 0x7f800000)) - reference(INFINITY)) <= std::ldexp(1.0, -23));
+    REQUIRE(std::fabs((double)toFloat(calcFunction(top, 0xff800000)) - reference(-INFINITY)) <= std::ldexp(1.0, -23));
+#endif
+
+    // f(NaN) = NaN
+    REQUIRE(calcFunction(top, 0x7fc00000) == 0x7fffffff);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatFunction]")
+{
+    VFloatFunction* top = new VFloatFunction { new VerilatedContext };
+    top->ce = 1;
+
+    // Clear the pipeline with a NaN
+    calcFunction(top, 0x7fc00000);
+
+    top->in = 0x3f800000; // f(1)
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->out == 0x7fffffff);
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->out == 0x7fffffff);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(std::fabs((double)toFloat(top->out) - reference(1.0)) <= std::ldexp(1.0, -23));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,290 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatGemm.h"
+
+// The size of the array and the MUL_DELAY are configured via the Makefile
+#ifndef TEST_ROWS
+#define TEST_ROWS 4
+#endif
+#ifndef TEST_COLUMNS
+#define TEST_COLUMNS 4
+#endif
+#ifndef TEST_MUL_DELAY
+#define TEST_MUL_DELAY 2
+#endif
+static constexpr uint32_t LANES = 4;
+static constexpr uint32_t TILE_ROWS = TEST_ROWS * LANES;
+static constexpr uint32_t LATENCY = (TEST_ROWS - 1) + (TEST_COLUMNS - 1) + 2 + TEST_MUL_DELAY + 4;
+
+// Row major matrix
+struct Matrix
+{
+    uint32_t rows;
+    uint32_t columns;
+    std::vector<float> values;
+
+    Matrix(uint32_t r, uint32_t c) : rows { r }, columns { c }, values(r * c, 0.0f) { }
+    float& at(uint32_t r, uint32_t c) { return values[(r * columns) + c]; }
+    float at(uint32_t r, uint32_t c) const { return ((r < rows) && (c < columns)) ? values[(r * columns) + c] : 0.0f; }
+};
+
+void clk(VFloatGemm* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+// Access to the 32 bit words of a port. Verilator uses different types depending on the width
+template <typename T>
+void setWord(T& port, uint32_t index, uint32_t value)
+{
+    port[index] = value;
+}
+
+void setWord(uint64_t& port, uint32_t index, uint32_t value)
+{
+    port = (port & ~(0xffffffffull << (index * 32))) | ((uint64_t)value << (index * 32));
+}
+
+void setWord(uint32_t& port, uint32_t, uint32_t value)
+{
+    port = value;
+}
+
+template <typename T>
+uint32_t getWord(const T& port, uint32_t index)
+{
+    return port[index];
+}
+
+uint32_t getWord(const uint64_t& port, uint32_t index)
+{
+    return port >> (index * 32);
+}
+
+Matrix randomMatrix(std::mt19937& rng, uint32_t rows, uint32_t columns)
+{
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    Matrix m { rows, columns };
+    for (float& v : m.values)
+        v = dist(rng);
+    return m;
+}
+
+// Splits C into tiles of TILE_ROWS x TEST_COLUMNS and streams them back to back into the array.
+// ceRate is the probability in percent that ce is set. Returns C and the number of clocks.
+Matrix runGemm(VFloatGemm* top, const Matrix& a, const Matrix& b, uint32_t ceRate, std::mt19937& rng, uint64_t& clocks)
+{
+    struct Step
+    {
+        uint32_t row;
+        uint32_t column;
+        uint32_t k;
+    };
+    std::deque<Step> steps;
+    std::deque<Step> results;
+    Matrix c { a.rows, b.columns };
+
+    for (uint32_t row = 0; row < a.rows; row += TILE_ROWS)
+        for (uint32_t column = 0; column < b.columns; column += TEST_COLUMNS)
+            for (uint32_t k = 0; k < a.columns; k++)
+                for (uint32_t l = 0; l < LANES; l++)
+                    steps.push_back({ row + (l * TEST_ROWS), column, k });
+
+    // Flush the pipeline
+    top->ce = 1;
+    top->inLast = 0;
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+
+    clocks = 0;
+    uint32_t expected = steps.size() / a.columns;
+    while (expected > 0)
+    {
+        REQUIRE(clocks < (100 * (steps.size() + LATENCY)));
+        top->ce = (rng() % 100) < ceRate;
+        top->inFirst = 0;
+        top->inLast = 0;
+        if (!steps.empty())
+        {
+            const Step& s = steps.front();
+            for (uint32_t i = 0; i < TEST_ROWS; i++)
+                setWord(top->a, i, toUint(a.at(s.row + i, s.k)));
+            for (uint32_t j = 0; j < TEST_COLUMNS; j++)
+                setWord(top->b, j, toUint(b.at(s.k, s.column + j)));
+            top->inFirst = s.k == 0;
+            top->inLast = s.k == (a.columns - 1);
+        }
+        top->eval();
+        if (top->ce && top->outValid)
+        {
+            REQUIRE(!results.empty());
+            const Step& s = results.front();
+            for (uint32_t i = 0; i < TEST_ROWS; i++)
+                for (uint32_t j = 0; j < TEST_COLUMNS; j++)
+                    if (((s.row + i) < c.rows) && ((s.column + j) < c.columns))
+                        c.at(s.row + i, s.column + j) = toFloat(getWord(top->c, (i * TEST_COLUMNS) + j));
+            results.pop_front();
+            expected--;
+        }
+        if (top->ce && !steps.empty())
+        {
+            if (top->inLast)
+                results.push_back(steps.front());
+            steps.pop_front();
+        }
+        clk(top);
+        clocks++;
+    }
+    return c;
+}
+
+// Every product is truncated and every addition is rounded. The error of the k-th
+// addition is relative to the partial sum.
+void checkGemm(const Matrix& a, const Matrix& b, const Matrix& c, double& maxError)
+{
+    for (uint32_t i = 0; i < c.rows; i++)
+    {
+        for (uint32_t j = 0; j < c.columns; j++)
+        {
+            double reference = 0.0;
+            double magnitude = 0.0;
+            for (uint32_t k = 0; k < a.columns; k++)
+            {
+                reference += (double)a.at(i, k) * (double)b.at(k, j);
+                magnitude += std::fabs((double)a.at(i, k) * (double)b.at(k, j));
+            }
+            const double error = std::fabs((double)c.at(i, j) - reference);
+            const double bound = (a.columns + 1) * magnitude * std::ldexp(1.0, -23);
+            REQUIRE(error <= bound);
+            maxError = std::fmax(maxError, (bound > 0.0) ? (error / bound) : 0.0);
+        }
+    }
+}
+
+TEST_CASE("Random GEMMs", "[FloatGemm]")
+{
+    VFloatGemm* top = new VFloatGemm { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    std::uniform_int_distribution<uint32_t> size { 1, 40 };
+    double maxError = 0.0;
+    uint64_t macs = 0;
+    uint64_t paddedMacs = 0;
+    uint64_t totalClocks = 0;
+
+    for (uint32_t n = 0; n < 200; n++)
+    {
+        const uint32_t m = size(rng);
+        const uint32_t k = size(rng);
+        const uint32_t p = size(rng);
+        const Matrix a = randomMatrix(rng, m, k);
+        const Matrix b = randomMatrix(rng, k, p);
+        uint64_t clocks = 0;
+        const Matrix c = runGemm(top, a, b, 100, rng, clocks);
+        checkGemm(a, b, c, maxError);
+
+        const uint64_t tiles = ((m + TILE_ROWS - 1) / TILE_ROWS) * ((p + TEST_COLUMNS - 1) / TEST_COLUMNS);
+        // One step per clock, the array is only stalled while the pipeline is drained
+        REQUIRE(clocks == ((tiles * k * LANES) + LATENCY));
+        macs += (uint64_t)m * k * p;
+        paddedMacs += tiles * TILE_ROWS * TEST_COLUMNS * k;
+        totalClocks += clocks;
+    }
+    std::printf("FloatGemm (%d x %d): Max error %f of the bound\n", TEST_ROWS, TEST_COLUMNS, maxError);
+    std::printf("FloatGemm (%d x %d): %f MACs per clock (%f including the padding, peak %d)\n", 
+        TEST_ROWS, TEST_COLUMNS, (double)macs / totalClocks, (double)paddedMacs / totalClocks, TEST_ROWS * TEST_COLUMNS);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatGemm]")
+{
+    VFloatGemm* top = new VFloatGemm { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    uint64_t clocks = 0;
+
+    // I * B = B and A * I = A
+    Matrix identity { 20, 20 };
+    for (uint32_t i = 0; i < identity.rows; i++)
+        identity.at(i, i) = 1.0f;
+    const Matrix m = randomMatrix(rng, 20, 20);
+    REQUIRE(runGemm(top, identity, m, 100, rng, clocks).values == m.values);
+    REQUIRE(runGemm(top, m, identity, 100, rng, clocks).values == m.values);
+
+    // K = 1: outer product
+    Matrix a { 3, 1 };
+    Matrix b { 1, 2 };
+    a.values = { 1.0f, 2.0f, -3.0f };
+    b.values = { 0.5f, 4.0f };
+    REQUIRE(runGemm(top, a, b, 100, rng, clocks).values == std::vector<float> { 0.5f, 4.0f, 1.0f, 8.0f, -1.5f, -12.0f });
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatGemm]")
+{
+    VFloatGemm* top = new VFloatGemm { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    uint64_t clocks = 0;
+
+    const Matrix a = randomMatrix(rng, 33, 17);
+    const Matrix b = randomMatrix(rng, 17, 9);
+    const Matrix c = runGemm(top, a, b, 100, rng, clocks);
+    const Matrix stalled = runGemm(top, a, b, 60, rng, clocks);
+    for (uint32_t i = 0; i < c.values.size(); i++)
+        REQUIRE(toUint(stalled.values[i]) == toUint(c.values[i]));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
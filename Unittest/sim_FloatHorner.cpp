@@ -0,0 +1,177 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatHorner.h"
+
+// The degree and the coefficients are configured via the Makefile. They are the
+// Newton-Raphson iterations of inv_fast (see Example/sim_ExampleNewtonRecip.cpp).
+#ifndef TEST_DEGREE
+#define TEST_DEGREE 3
+#endif
+#if TEST_DEGREE == 3
+static const double COEFFICIENTS[] = { 4.0, -6.0, 4.0, -1.0 };
+#else
+static const double COEFFICIENTS[] = { 8.0, -28.0, 56.0, -70.0, 56.0, -28.0, 8.0, -1.0 };
+#endif
+static constexpr uint32_t LATENCY = 2 + (TEST_DEGREE * 4);
+
+void clk(VFloatHorner* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+// The error of every multiplication and addition is relative to its result. The
+// bound uses the sum of the magnitudes of all terms to include cancellations.
+void checkHorner(uint32_t in, uint32_t out, double& maxError)
+{
+    const double x = toFloat(in);
+    double reference = 0.0;
+    double magnitude = 0.0;
+    for (int j = TEST_DEGREE; j >= 0; j--)
+    {
+        reference = (reference * x) + COEFFICIENTS[j];
+        magnitude = (magnitude * std::fabs(x)) + std::fabs(COEFFICIENTS[j]);
+    }
+    const double error = std::fabs((double)toFloat(out) - reference);
+    const double bound = (std::fabs(reference) + (2.0 * TEST_DEGREE * magnitude)) * std::ldexp(1.0, -23);
+    REQUIRE(error <= bound);
+    maxError = std::fmax(maxError, error / bound);
+}
+
+uint32_t calcHorner(VFloatHorner* top, uint32_t in)
+{
+    top->x = in;
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return top->y;
+}
+
+void runTest(VFloatHorner* top, float from, float to)
+{
+    std::mt19937 rng { 1234 };
+    std::uniform_real_distribution<float> dist { from, to };
+    std::deque<uint32_t> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        top->x = toUint(dist(rng));
+        history.push_back(top->x);
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkHorner(history.front(), top->y, maxError);
+            history.pop_front();
+        }
+    }
+    std::printf("FloatHorner (DEGREE = %d): Max error %f of the bound in %f .. %f\n", TEST_DEGREE, maxError, from, to);
+}
+
+TEST_CASE("Random numbers", "[FloatHorner]")
+{
+    VFloatHorner* top = new VFloatHorner { new VerilatedContext };
+
+    runTest(top, -2.0f, 2.0f);
+    // Range of w in inv_fast
+    runTest(top, 0.9f, 1.1f);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatHorner]")
+{
+    VFloatHorner* top = new VFloatHorner { new VerilatedContext };
+    top->ce = 1;
+
+    // p(0) = c[0]
+    REQUIRE(calcHorner(top, 0x00000000) == toUint(COEFFICIENTS[0]));
+
+    // p(1) = 1 (the Newton-Raphson iteration of an exact reciprocal)
+    REQUIRE(calcHorner(top, 0x3f800000) == 0x3f800000);
+
+    // p(0.5), all intermediate results are exact
+    double reference = 0.0;
+    for (int j = TEST_DEGREE; j >= 0; j--)
+        reference = (reference * 0.5) + COEFFICIENTS[j];
+    REQUIRE(calcHorner(top, 0x3f000000) == toUint(reference));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatHorner]")
+{
+    VFloatHorner* top = new VFloatHorner { new VerilatedContext };
+    top->ce = 1;
+
+    // Clear the pipeline with p(1) = 1
+    calcHorner(top, 0x3f800000);
+
+    top->x = 0x00000000; // p(0) = c[0]
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->y == 0x3f800000);
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->y == 0x3f800000);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->y == toUint(COEFFICIENTS[0]));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
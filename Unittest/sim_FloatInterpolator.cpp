@@ -0,0 +1,278 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatInterpolator.h"
+
+// The module is verilated with TAG_SIZE = 16 (see Makefile). Bit 15 of the tag is the valid bit.
+#ifndef TEST_ATTRIBUTES
+#define TEST_ATTRIBUTES 4
+#endif
+static constexpr uint32_t PLANES = TEST_ATTRIBUTES + 1;
+static constexpr uint32_t ADD_LATENCY = 4;
+static constexpr uint32_t VALID = 0x8000;
+
+void clk(VFloatInterpolator* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+template <typename T>
+uint32_t getWord(const T& port, uint32_t index)
+{
+    return port[index];
+}
+
+uint32_t getWord(const uint64_t& port, uint32_t index)
+{
+    return port >> (index * 32);
+}
+
+uint32_t getWord(const uint32_t& port, uint32_t)
+{
+    return port;
+}
+
+// The bounding box of a triangle with the planes { a, b, c } of 1 / w (plane 0) and attribute / w
+struct Triangle
+{
+    uint32_t width;
+    uint32_t height;
+    float planes[PLANES][3];
+};
+
+struct Pixel
+{
+    const Triangle* triangle;
+    uint32_t x;
+    uint32_t y;
+};
+
+// Every value of a plane is the result of roughly x / 4 + y + 2 additions of the lanes and rows.
+// The error of 1 / w is amplified by the reciprocal. The FloatRecip has a relative error of about 1e-6.
+void checkPixel(const Pixel& pixel, VFloatInterpolator* top, double& maxError)
+{
+    double value[PLANES];
+    double valueError[PLANES];
+    for (uint32_t p = 0; p < PLANES; p++)
+    {
+        const float* plane = pixel.triangle->planes[p];
+        value[p] = (double)plane[0] + ((double)plane[1] * pixel.x) + ((double)plane[2] * pixel.y);
+        const double magnitude = std::fabs(plane[0]) + std::fabs((double)plane[1] * pixel.x) + std::fabs((double)plane[2] * pixel.y);
+        valueError[p] = (((double)pixel.x / 4.0) + pixel.y + 3.0) * std::ldexp(magnitude, -23);
+    }
+    const double w = 1.0 / value[0];
+    const double wError = valueError[0] / std::fabs(value[0]);
+
+    double bound = std::fabs(w) * (wError + 2e-6);
+    double error = std::fabs((double)toFloat(top->outW) - w);
+    REQUIRE(error <= bound);
+    maxError = std::fmax(maxError, error / bound);
+
+    for (uint32_t k = 0; k < TEST_ATTRIBUTES; k++)
+    {
+        const double reference = value[k + 1] * w;
+        bound = (valueError[k + 1] * std::fabs(w)) + (std::fabs(reference) * (wError + 4e-6));
+        error = std::fabs((double)toFloat(getWord(top->outAttributes, k)) - reference);
+        REQUIRE(error <= bound);
+        maxError = std::fmax(maxError, error / bound);
+    }
+}
+
+// Writes the planes of the triangles and walks their bounding boxes. The pipeline is stalled while
+// the planes are written. ceRate is the probability in percent that ce is set while the pixels are walked.
+// Returns the number of checked pixels.
+uint32_t runTriangles(VFloatInterpolator* top, const std::vector<Triangle>& triangles, uint32_t ceRate, std::mt19937& rng, double& maxError)
+{
+    std::deque<Pixel> expected;
+    uint32_t checked = 0;
+    uint32_t tag = 0;
+
+    auto step = [&](bool ce, bool first, bool newRow, uint32_t inTag) {
+        top->ce = ce;
+        top->inFirst = first;
+        top->inNewRow = newRow;
+        top->inTag = inTag;
+        top->eval();
+        if (top->ce && (top->outTag & VALID))
+        {
+            REQUIRE(!expected.empty());
+            REQUIRE(top->outTag == (VALID | (checked & 0x7fff)));
+            checkPixel(expected.front(), top, maxError);
+            expected.pop_front();
+            checked++;
+        }
+        clk(top);
+    };
+
+    for (const Triangle& t : triangles)
+    {
+        top->ce = 0;
+        top->setupWe = 1;
+        for (uint32_t p = 0; p < PLANES; p++)
+        {
+            top->setupAddr = p;
+            top->setupA = toUint(t.planes[p][0]);
+            top->setupB = toUint(t.planes[p][1]);
+            top->setupC = toUint(t.planes[p][2]);
+            clk(top);
+        }
+        top->setupWe = 0;
+        for (uint32_t i = 0; i < ADD_LATENCY; i++)
+            step(false, false, false, 0);
+
+        for (uint32_t y = 0; y < t.height; y++)
+        {
+            for (uint32_t x = 0; x < t.width;)
+            {
+                const bool ce = (rng() % 100) < ceRate;
+                if (ce)
+                    expected.push_back({ &t, x, y });
+                step(ce, (x == 0) && (y == 0), (x == 0) && (y != 0), VALID | (tag & 0x7fff));
+                if (ce)
+                {
+                    x++;
+                    tag++;
+                }
+            }
+        }
+    }
+    while (!expected.empty())
+        step(true, false, false, 0);
+    return checked;
+}
+
+// 1 / w stays in [0.25, 1.25] in a bounding box of up to 64 x 64 pixels
+std::vector<Triangle> randomTriangles(std::mt19937& rng, uint32_t count)
+{
+    std::uniform_int_distribution<uint32_t> width { 4, 64 };
+    std::uniform_int_distribution<uint32_t> height { 1, 64 };
+    std::uniform_real_distribution<float> q { 0.5f, 1.0f };
+    std::uniform_real_distribution<float> qStep { -0.002f, 0.002f };
+    std::uniform_real_distribution<float> attribute { -4.0f, 4.0f };
+    std::uniform_real_distribution<float> attributeStep { -0.1f, 0.1f };
+    std::vector<Triangle> triangles(count);
+    for (Triangle& t : triangles)
+    {
+        t.width = width(rng);
+        t.height = height(rng);
+        t.planes[0][0] = q(rng);
+        t.planes[0][1] = qStep(rng);
+        t.planes[0][2] = qStep(rng);
+        for (uint32_t p = 1; p < PLANES; p++)
+        {
+            t.planes[p][0] = attribute(rng);
+            t.planes[p][1] = attributeStep(rng);
+            t.planes[p][2] = attributeStep(rng);
+        }
+    }
+    return triangles;
+}
+
+TEST_CASE("Random triangles", "[FloatInterpolator]")
+{
+    VFloatInterpolator* top = new VFloatInterpolator { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    const std::vector<Triangle> triangles = randomTriangles(rng, 500);
+
+    double maxError = 0.0;
+    uint32_t pixels = 0;
+    for (const Triangle& t : triangles)
+        pixels += t.width * t.height;
+    REQUIRE(runTriangles(top, triangles, 100, rng, maxError) == pixels);
+    std::printf("FloatInterpolator (ATTRIBUTES = %d): Max error %f of the bound\n", TEST_ATTRIBUTES, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatInterpolator]")
+{
+    VFloatInterpolator* top = new VFloatInterpolator { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    double maxError = 0.0;
+
+    // Constant planes, a row with the minimum width and integer steps which are calculated exactly
+    std::vector<Triangle> triangles(3);
+    triangles[0] = { 8, 8, {} };
+    triangles[1] = { 4, 5, {} };
+    triangles[2] = { 16, 16, {} };
+    for (uint32_t p = 0; p < PLANES; p++)
+    {
+        triangles[0].planes[p][0] = (p == 0) ? 0.5f : 3.0f;
+        triangles[1].planes[p][0] = (p == 0) ? 0.25f : -1.0f;
+        triangles[1].planes[p][1] = (p == 0) ? 0.0f : 2.0f;
+        triangles[1].planes[p][2] = (p == 0) ? 0.0f : 8.0f;
+        triangles[2].planes[p][0] = 1.0f;
+        triangles[2].planes[p][1] = (p == 0) ? 0.0f : 1.0f;
+        triangles[2].planes[p][2] = (p == 0) ? 0.0f : 16.0f;
+    }
+    REQUIRE(runTriangles(top, triangles, 100, rng, maxError) == (8 * 8) + (4 * 5) + (16 * 16));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatInterpolator]")
+{
+    VFloatInterpolator* top = new VFloatInterpolator { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    const std::vector<Triangle> triangles = randomTriangles(rng, 100);
+
+    // The tags stay aligned to the attributes when the pipeline is stalled
+    double maxError = 0.0;
+    uint32_t pixels = 0;
+    for (const Triangle& t : triangles)
+        pixels += t.width * t.height;
+    REQUIRE(runTriangles(top, triangles, 60, rng, maxError) == pixels);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,177 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatLerp.h"
+
+static constexpr uint32_t LATENCY = 9;
+
+void clk(VFloatLerp* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+struct Operands
+{
+    uint32_t a;
+    uint32_t b;
+    uint32_t t;
+};
+
+// The result is rounded once. The truncation of the intermediate results is covered by
+// the guard bits, its error is relative to the magnitude of the operands.
+void checkLerp(const Operands& op, uint32_t out, double& maxError)
+{
+    const double a = toFloat(op.a);
+    const double b = toFloat(op.b);
+    const double reference = a + ((double)toFloat(op.t) * (b - a));
+    const double error = std::fabs((double)toFloat(out) - reference);
+    const double bound = (std::fabs(reference) * std::ldexp(1.0, -24)) + ((std::fabs(a) + std::fabs(b)) * std::ldexp(1.0, -23));
+    REQUIRE(error <= bound);
+    maxError = std::fmax(maxError, error / bound);
+}
+
+uint32_t calcLerp(VFloatLerp* top, float a, float b, float t)
+{
+    top->a = toUint(a);
+    top->b = toUint(b);
+    top->t = toUint(t);
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return top->out;
+}
+
+// nearby selects operands which are close together, so that b - a cancels
+void runTest(VFloatLerp* top, float from, float to, bool nearby)
+{
+    std::mt19937 rng { 1234 };
+    std::uniform_real_distribution<float> dist { from, to };
+    std::uniform_real_distribution<float> weight { 0.0f, 1.0f };
+    std::uniform_real_distribution<float> offset { -1e-3f, 1e-3f };
+    std::deque<Operands> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        const float a = dist(rng);
+        const float b = (nearby) ? a * (1.0f + offset(rng)) : dist(rng);
+        history.push_back({ toUint(a), toUint(b), toUint(weight(rng)) });
+        top->a = history.back().a;
+        top->b = history.back().b;
+        top->t = history.back().t;
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkLerp(history.front(), top->out, maxError);
+            history.pop_front();
+        }
+    }
+    std::printf("FloatLerp: Max error %f of the bound in %f .. %f%s\n", maxError, from, to, (nearby) ? " (nearby)" : "");
+}
+
+TEST_CASE("Random numbers", "[FloatLerp]")
+{
+    VFloatLerp* top = new VFloatLerp { new VerilatedContext };
+
+    runTest(top, -1.0f, 1.0f, false);
+    runTest(top, 0.0f, 1000.0f, false);
+    runTest(top, -10.0f, 10.0f, true);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatLerp]")
+{
+    VFloatLerp* top = new VFloatLerp { new VerilatedContext };
+    top->ce = 1;
+
+    // t = 0 returns exactly a
+    REQUIRE(calcLerp(top, 0.1f, -3.7f, 0.0f) == toUint(0.1f));
+    REQUIRE(calcLerp(top, -1234.5f, 1e-3f, 0.0f) == toUint(-1234.5f));
+
+    // a == b returns a
+    REQUIRE(calcLerp(top, 0.3f, 0.3f, 0.77f) == toUint(0.3f));
+
+    // Exact intermediate results
+    REQUIRE(calcLerp(top, 1.0f, 3.0f, 0.5f) == toUint(2.0f));
+    REQUIRE(calcLerp(top, 0.0f, -5.5f, 1.0f) == toUint(-5.5f));
+    REQUIRE(calcLerp(top, 4.0f, 2.0f, 0.25f) == toUint(3.5f));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatLerp]")
+{
+    VFloatLerp* top = new VFloatLerp { new VerilatedContext };
+    top->ce = 1;
+
+    // Clear the pipeline with lerp(1, 3, 0.5) = 2
+    calcLerp(top, 1.0f, 3.0f, 0.5f);
+
+    top->t = toUint(0.0f); // lerp(1, 3, 0) = 1
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->out == toUint(2.0f));
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->out == toUint(2.0f));
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->out == toUint(1.0f));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
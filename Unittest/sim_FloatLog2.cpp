@@ -0,0 +1,180 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatLog2.h"
+
+// The degree of the polynomial is configured via the Makefile
+#ifndef TEST_DEGREE
+#define TEST_DEGREE 2
+#endif
+static constexpr uint32_t LATENCY = TEST_DEGREE + 4;
+static constexpr double MAX_ULP_ERROR = 1.0;
+// Results in the range of -1.0 .. 1.0 are calculated in fixed point
+static const double MAX_ABS_ERROR = std::ldexp(1.0, -23);
+
+void clk(VFloatLog2* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+struct Error
+{
+    double ulp { 0.0 };
+    double abs { 0.0 };
+};
+
+// Checks the result of a positive normalized number
+void checkLog2(uint32_t in, uint32_t out, Error& maxError)
+{
+    const double reference = std::log2((double)toFloat(in));
+    const double error = std::fabs((double)toFloat(out) - reference);
+    if (std::fabs(reference) < 1.0)
+    {
+        REQUIRE(error < MAX_ABS_ERROR);
+        maxError.abs = std::fmax(maxError.abs, error);
+    }
+    else
+    {
+        const double ulp = std::ldexp(1.0, std::ilogb(reference) - 23);
+        REQUIRE((error / ulp) < MAX_ULP_ERROR);
+        maxError.ulp = std::fmax(maxError.ulp, error / ulp);
+    }
+}
+
+uint32_t calcLog2(VFloatLog2* top, uint32_t in)
+{
+    top->in = in;
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return top->out;
+}
+
+TEST_CASE("Sweep (all normalized numbers)", "[FloatLog2]")
+{
+    VFloatLog2* top = new VFloatLog2 { new VerilatedContext };
+    std::deque<uint32_t> history;
+    Error maxError {};
+    top->ce = 1;
+
+    for (uint32_t i = 0x00800000; i < 0x7f800000; i += 0x1f)
+    {
+        top->in = i;
+        history.push_back(top->in);
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkLog2(history.front(), top->out, maxError);
+            history.pop_front();
+        }
+    }
+    std::printf("FloatLog2 (DEGREE = %d): Max error %f ulp, max absolute error 2^%f in (-1.0 .. 1.0)\n", 
+        TEST_DEGREE, maxError.ulp, std::log2(maxError.abs));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatLog2]")
+{
+    VFloatLog2* top = new VFloatLog2 { new VerilatedContext };
+    top->ce = 1;
+
+    // log2(1) = 0
+    REQUIRE(calcLog2(top, 0x3f800000) == 0x00000000);
+
+    // log2(2) = 1
+    REQUIRE(calcLog2(top, 0x40000000) == 0x3f800000);
+
+    // log2(0.5) = -1
+    REQUIRE(calcLog2(top, 0x3f000000) == 0xbf800000);
+
+    // log2(1024) = 10
+    REQUIRE(calcLog2(top, 0x44800000) == 0x41200000);
+
+    // log2(1.17549435E-38) = -126
+    REQUIRE(calcLog2(top, 0x00800000) == 0xc2fc0000);
+
+    // log2(0) = -Inf
+    REQUIRE(calcLog2(top, 0x00000000) == 0xff800000);
+
+    // log2(1.4E-45) = -Inf (denormalized numbers are handled like zero)
+    REQUIRE(calcLog2(top, 0x00000001) == 0xff800000);
+
+    // log2(-1) = NaN
+    REQUIRE(calcLog2(top, 0xbf800000) == 0x7fffffff);
+
+    // log2(Inf) = Inf
+    REQUIRE(calcLog2(top, 0x7f800000) == 0x7f800000);
+
+    // log2(NaN) = NaN
+    REQUIRE(calcLog2(top, 0x7fc00000) == 0x7fffffff);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatLog2]")
+{
+    VFloatLog2* top = new VFloatLog2 { new VerilatedContext };
+
+    top->in = 0x44800000; // log2(1024)
+    top->ce = 1;
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->out != 0x41200000);
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->out != 0x41200000);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(top->out == 0x41200000);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,111 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatMulConstTest.h"
+
+// The constant is configured via the Makefile. The same test is executed for
+// the shift and add network and the power of two fast path.
+
+void clk(VFloatMulConstTest* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+void runTest(VFloatMulConstTest* top, std::mt19937& rng, bool randomCe)
+{
+    // Fill the pipeline before the results are compared
+    int pipelineCounter = 8;
+    for (uint32_t i = 0; i < 2000000; i++)
+    {
+        top->ce = randomCe ? ((rng() % 4) != 0) : 1;
+        // Mix completely random bit patterns (inf, denormals, ...) with numbers around 1.0
+        top->in = (rng() & 1) ? rng() : ((rng() & 0x807fffff) | ((0x70 + (rng() % 0x20)) << 23));
+        clk(top);
+
+        if (pipelineCounter == 0)
+        {
+            REQUIRE(top->prod == top->refProd);
+        }
+        else if (top->ce)
+        {
+            pipelineCounter--;
+        }
+    }
+}
+
+TEST_CASE("Bit exact to FloatMul", "[FloatMulConst]")
+{
+    VFloatMulConstTest* top = new VFloatMulConstTest { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+
+    runTest(top, rng, false);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatMulConst]")
+{
+    VFloatMulConstTest* top = new VFloatMulConstTest { new VerilatedContext };
+    std::mt19937 rng { 4321 };
+
+    runTest(top, rng, true);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Range (a[0 to 2^32])", "[FloatMulConst]")
+{
+    VFloatMulConstTest* top = new VFloatMulConstTest { new VerilatedContext };
+    top->ce = 1;
+
+    int pipelineCounter = 4;
+    for (uint64_t i = 0; i < 0x100000000ull; i += 0x3f)
+    {
+        top->in = (uint32_t)i;
+        clk(top);
+        if (pipelineCounter == 0)
+            REQUIRE(top->prod == top->refProd);
+        else
+            pipelineCounter--;
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
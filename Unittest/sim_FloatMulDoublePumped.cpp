@@ -0,0 +1,129 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatMulDoublePumpedTest.h"
+
+// One cycle of clk contains two cycles of clk2x. Both clocks are phase aligned.
+void clk(VFloatMulDoublePumpedTest* t)
+{
+    t->clk = 0;
+    t->clk2x = 0;
+    t->eval();
+    t->clk2x = 1;
+    t->eval();
+    t->clk2x = 0;
+    t->eval();
+    t->clk = 1;
+    t->clk2x = 1;
+    t->eval();
+}
+
+uint32_t randomFloat(std::mt19937& rng)
+{
+    // Mix completely random bit patterns (inf, denormals, ...) with
+    // numbers around 1.0, where most of the products are encodable
+    if (rng() & 1)
+        return rng();
+    return (rng() & 0x807fffff) | ((0x70 + (rng() % 0x20)) << 23);
+}
+
+void runTest(VFloatMulDoublePumpedTest* top, std::mt19937& rng, bool randomCe)
+{
+    // Fill the pipeline before the results are compared
+    int pipelineCounter = 8;
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        top->ce = randomCe ? ((rng() % 4) != 0) : 1;
+        top->facA0In = randomFloat(rng);
+        top->facB0In = randomFloat(rng);
+        top->facA1In = randomFloat(rng);
+        top->facB1In = randomFloat(rng);
+        clk(top);
+
+        if (pipelineCounter == 0)
+        {
+            REQUIRE(top->prod0 == top->refProd0);
+            REQUIRE(top->prod1 == top->refProd1);
+        }
+        else if (top->ce)
+        {
+            pipelineCounter--;
+        }
+    }
+}
+
+TEST_CASE("Bit exact to FloatMul", "[FloatMulDoublePumped]")
+{
+    VFloatMulDoublePumpedTest* top = new VFloatMulDoublePumpedTest { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+
+    runTest(top, rng, false);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatMulDoublePumped]")
+{
+    VFloatMulDoublePumpedTest* top = new VFloatMulDoublePumpedTest { new VerilatedContext };
+    std::mt19937 rng { 4321 };
+
+    runTest(top, rng, true);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatMulDoublePumped]")
+{
+    VFloatMulDoublePumpedTest* top = new VFloatMulDoublePumpedTest { new VerilatedContext };
+    top->ce = 1;
+
+    // 2.0 * 3.0 = 6.0 and 3.14159265 * 2.71828183 = 8.539734
+    top->facA0In = 0x40000000;
+    top->facB0In = 0x40400000;
+    top->facA1In = 0x40490fdb;
+    top->facB1In = 0x402df854;
+    // The pipeline has a latency of 4 clocks until the result is computed.
+    clk(top);
+    clk(top);
+    clk(top);
+    clk(top);
+    REQUIRE(top->prod0 == 0x40c00000);
+    REQUIRE(top->prod1 == 0x4108a2c0);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
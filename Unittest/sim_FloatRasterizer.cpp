@@ -0,0 +1,264 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatRasterizer.h"
+
+// The module is verilated with TAG_SIZE = 16 (see Makefile)
+#ifndef TEST_QUAD_SIZE
+#define TEST_QUAD_SIZE 2
+#endif
+static constexpr int64_t SUBPIXEL_BITS = 4;
+static constexpr uint32_t MAX_REGION = 64; // In pixels, COORD_SIZE = 6
+
+void clk(VFloatRasterizer* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+// The vertices are on the subpixel grid and relative to the upper left corner of the region
+struct Triangle
+{
+    float x[3];
+    float y[3];
+    uint32_t quadsX;
+    uint32_t quadsY;
+};
+
+using Pixels = std::set<std::tuple<uint32_t, uint32_t, uint32_t>>; // Triangle, x, y
+
+// Exact evaluation of the edge functions at the pixel centers on the subpixel grid
+void rasterize(const Triangle& t, uint32_t index, Pixels& pixels)
+{
+    const double scale = (double)(1 << SUBPIXEL_BITS);
+    for (uint32_t py = 0; py < t.quadsY * TEST_QUAD_SIZE; py++)
+    {
+        for (uint32_t px = 0; px < t.quadsX * TEST_QUAD_SIZE; px++)
+        {
+            bool covered = true;
+            for (uint32_t e = 0; e < 3; e++)
+            {
+                const uint32_t j = (e + 1) % 3;
+                const int64_t xi = (int64_t)(t.x[e] * scale);
+                const int64_t yi = (int64_t)(t.y[e] * scale);
+                const int64_t xj = (int64_t)(t.x[j] * scale);
+                const int64_t yj = (int64_t)(t.y[j] * scale);
+                const int64_t a = yi - yj;
+                const int64_t b = xj - xi;
+                const int64_t value = (a * ((px << SUBPIXEL_BITS) + (1 << (SUBPIXEL_BITS - 1))))
+                    + (b * ((py << SUBPIXEL_BITS) + (1 << (SUBPIXEL_BITS - 1))))
+                    + ((xi * yj) - (xj * yi));
+                covered = covered && ((value > 0) || ((value == 0) && ((a > 0) || ((a == 0) && (b > 0)))));
+            }
+            if (covered)
+                pixels.insert({ index, px, py });
+        }
+    }
+}
+
+void reset(VFloatRasterizer* top)
+{
+    top->resetn = 0;
+    top->inValid = 0;
+    top->outReady = 1;
+    for (uint32_t i = 0; i < 32; i++)
+        clk(top);
+    top->resetn = 1;
+}
+
+// Sends the triangles and collects the covered pixels of the quads.
+// validRate and readyRate are the probabilities in percent that inValid and outReady are set.
+Pixels runRasterizer(VFloatRasterizer* top, const std::vector<Triangle>& triangles, uint32_t validRate, uint32_t readyRate, std::mt19937& rng)
+{
+    Pixels pixels;
+    std::set<std::tuple<uint32_t, uint32_t, uint32_t>> quads;
+    uint32_t sent = 0;
+    uint32_t idle = 0; // Clocks since the last quad, the rasterizer is empty after walking the largest region
+    uint64_t time = 0;
+    while ((sent < triangles.size()) || (idle < 2000))
+    {
+        REQUIRE(time++ < 100000000);
+        top->inValid = (sent < triangles.size()) && ((rng() % 100) < validRate);
+        top->outReady = (rng() % 100) < readyRate;
+        if (sent < triangles.size())
+        {
+            const Triangle& t = triangles[sent];
+            top->inX0 = toUint(t.x[0]);
+            top->inY0 = toUint(t.y[0]);
+            top->inX1 = toUint(t.x[1]);
+            top->inY1 = toUint(t.y[1]);
+            top->inX2 = toUint(t.x[2]);
+            top->inY2 = toUint(t.y[2]);
+            top->inMaxX = t.quadsX - 1;
+            top->inMaxY = t.quadsY - 1;
+            top->inTag = sent;
+        }
+        top->eval();
+        if (top->inValid && top->inReady)
+            sent++;
+        idle++;
+        if (top->outValid && top->outReady)
+        {
+            idle = 0;
+            // Every quad is sent once and only when it covers a pixel
+            REQUIRE(top->outMask != 0);
+            REQUIRE(quads.insert({ top->outTag, top->outX, top->outY }).second);
+            REQUIRE(top->outX < triangles[top->outTag].quadsX);
+            REQUIRE(top->outY < triangles[top->outTag].quadsY);
+            for (uint32_t i = 0; i < TEST_QUAD_SIZE * TEST_QUAD_SIZE; i++)
+            {
+                if ((top->outMask >> i) & 1)
+                    pixels.insert({ top->outTag, (top->outX * TEST_QUAD_SIZE) + (i % TEST_QUAD_SIZE), (top->outY * TEST_QUAD_SIZE) + (i / TEST_QUAD_SIZE) });
+            }
+        }
+        clk(top);
+    }
+    return pixels;
+}
+
+Pixels reference(const std::vector<Triangle>& triangles)
+{
+    Pixels pixels;
+    for (uint32_t i = 0; i < triangles.size(); i++)
+        rasterize(triangles[i], i, pixels);
+    return pixels;
+}
+
+// The vertices are up to 16 pixels outside of the region, most triangles are front facing
+std::vector<Triangle> randomTriangles(std::mt19937& rng, uint32_t count)
+{
+    std::uniform_int_distribution<uint32_t> quads { 1, MAX_REGION / TEST_QUAD_SIZE };
+    std::vector<Triangle> triangles(count);
+    for (Triangle& t : triangles)
+    {
+        t.quadsX = quads(rng);
+        t.quadsY = quads(rng);
+        std::uniform_int_distribution<int32_t> x { -16 << SUBPIXEL_BITS, (int32_t)((t.quadsX * TEST_QUAD_SIZE) + 16) << SUBPIXEL_BITS };
+        std::uniform_int_distribution<int32_t> y { -16 << SUBPIXEL_BITS, (int32_t)((t.quadsY * TEST_QUAD_SIZE) + 16) << SUBPIXEL_BITS };
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            t.x[i] = std::ldexp((float)x(rng), -SUBPIXEL_BITS);
+            t.y[i] = std::ldexp((float)y(rng), -SUBPIXEL_BITS);
+        }
+        const float area = ((t.x[1] - t.x[0]) * (t.y[2] - t.y[0])) - ((t.y[1] - t.y[0]) * (t.x[2] - t.x[0]));
+        if ((area < 0.0f) && ((rng() % 10) != 0))
+        {
+            std::swap(t.x[1], t.x[2]);
+            std::swap(t.y[1], t.y[2]);
+        }
+    }
+    return triangles;
+}
+
+TEST_CASE("Random triangles", "[FloatRasterizer]")
+{
+    VFloatRasterizer* top = new VFloatRasterizer { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    reset(top);
+
+    const std::vector<Triangle> triangles = randomTriangles(rng, 2000);
+    const Pixels expected = reference(triangles);
+    REQUIRE(runRasterizer(top, triangles, 100, 100, rng) == expected);
+    std::printf("FloatRasterizer (QUAD_SIZE = %d): %zu pixels of %zu triangles\n", TEST_QUAD_SIZE, expected.size(), triangles.size());
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatRasterizer]")
+{
+    VFloatRasterizer* top = new VFloatRasterizer { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    reset(top);
+
+    // Triangle which covers the whole region, a square which is split at the diagonal through
+    // the pixel centers, a back facing triangle and a triangle without an area
+    std::vector<Triangle> triangles {
+        { { -60.0f, 120.0f, -60.0f }, { -60.0f, -60.0f, 120.0f }, 4, 4 },
+        { { 0.0f, 8.0f, 8.0f }, { 0.0f, 0.0f, 8.0f }, 8 / TEST_QUAD_SIZE, 8 / TEST_QUAD_SIZE },
+        { { 0.0f, 8.0f, 0.0f }, { 0.0f, 8.0f, 8.0f }, 8 / TEST_QUAD_SIZE, 8 / TEST_QUAD_SIZE },
+        { { 0.0f, 0.0f, 8.0f }, { 0.0f, 8.0f, 0.0f }, 8 / TEST_QUAD_SIZE, 8 / TEST_QUAD_SIZE },
+        { { 0.5f, 4.5f, 2.5f }, { 0.5f, 4.5f, 2.5f }, 8 / TEST_QUAD_SIZE, 8 / TEST_QUAD_SIZE }
+    };
+    const Pixels pixels = runRasterizer(top, triangles, 100, 100, rng);
+    REQUIRE(pixels == reference(triangles));
+
+    uint32_t count[5] {};
+    std::set<std::pair<uint32_t, uint32_t>> square;
+    for (const auto& p : pixels)
+    {
+        count[std::get<0>(p)]++;
+        if ((std::get<0>(p) == 1) || (std::get<0>(p) == 2))
+            REQUIRE(square.insert({ std::get<1>(p), std::get<2>(p) }).second);
+    }
+    REQUIRE(count[0] == (4 * TEST_QUAD_SIZE) * (4 * TEST_QUAD_SIZE));
+    REQUIRE(square.size() == 64); // Every pixel of the square is covered exactly once
+    REQUIRE(count[3] == 0);
+    REQUIRE(count[4] == 0);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Backpressure and gaps", "[FloatRasterizer]")
+{
+    VFloatRasterizer* top = new VFloatRasterizer { new VerilatedContext };
+    std::mt19937 rng { 4321 };
+    reset(top);
+
+    const std::vector<Triangle> triangles = randomTriangles(rng, 500);
+    const Pixels expected = reference(triangles);
+    REQUIRE(runRasterizer(top, triangles, 30, 60, rng) == expected);
+    REQUIRE(runRasterizer(top, triangles, 90, 20, rng) == expected);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,239 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatSinCos.h"
+
+// The degree of the polynomial is configured via the Makefile
+#ifndef TEST_DEGREE
+#define TEST_DEGREE 2
+#endif
+static constexpr uint32_t LATENCY = TEST_DEGREE + 9;
+// The results are calculated in fixed point, the error is an absolute error
+static const double MAX_ABS_ERROR = std::ldexp(1.0, (TEST_DEGREE == 2) ? -22 : -21);
+
+void clk(VFloatSinCos* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+struct Result
+{
+    uint32_t sin;
+    uint32_t cos;
+};
+
+void checkSinCos(uint32_t in, const Result& out, double& maxError)
+{
+    const float x = toFloat(in);
+    const double sinError = std::fabs((double)toFloat(out.sin) - (double)std::sin(x));
+    const double cosError = std::fabs((double)toFloat(out.cos) - (double)std::cos(x));
+    REQUIRE(sinError < MAX_ABS_ERROR);
+    REQUIRE(cosError < MAX_ABS_ERROR);
+    maxError = std::fmax(maxError, std::fmax(sinError, cosError));
+}
+
+Result calcSinCos(VFloatSinCos* top, uint32_t in)
+{
+    top->in = in;
+    for (uint32_t i = 0; i < LATENCY; i++)
+        clk(top);
+    return { top->sin, top->cos };
+}
+
+double sweep(VFloatSinCos* top, float from, float to, uint32_t steps)
+{
+    std::deque<uint32_t> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    for (uint32_t i = 0; i <= (steps + LATENCY); i++)
+    {
+        top->in = toUint(from + ((to - from) * (float)i / (float)steps));
+        history.push_back(top->in);
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkSinCos(history.front(), { top->sin, top->cos }, maxError);
+            history.pop_front();
+        }
+    }
+    return maxError;
+}
+
+TEST_CASE("Sweep -2pi .. 2pi", "[FloatSinCos]")
+{
+    VFloatSinCos* top = new VFloatSinCos { new VerilatedContext };
+
+    const double maxError = sweep(top, -6.2831853f, 6.2831853f, 0x400000);
+    std::printf("FloatSinCos (DEGREE = %d): Max absolute error 2^%f in (-2pi .. 2pi)\n", 
+        TEST_DEGREE, std::log2(maxError));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Sweep -256 .. 256", "[FloatSinCos]")
+{
+    VFloatSinCos* top = new VFloatSinCos { new VerilatedContext };
+
+    const double maxError = sweep(top, -256.0f, 256.0f, 0x400000);
+    std::printf("FloatSinCos (DEGREE = %d): Max absolute error 2^%f in (-256 .. 256)\n", 
+        TEST_DEGREE, std::log2(maxError));
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Sweep small numbers", "[FloatSinCos]")
+{
+    VFloatSinCos* top = new VFloatSinCos { new VerilatedContext };
+    std::deque<uint32_t> history;
+    double maxError = 0.0;
+    top->ce = 1;
+
+    // 2 ** -20 .. 1.0
+    for (uint32_t i = 0x35800000; i < 0x3f800000; i += 0x1f)
+    {
+        top->in = i;
+        history.push_back(top->in);
+        clk(top);
+        if (history.size() == LATENCY)
+        {
+            checkSinCos(history.front(), { top->sin, top->cos }, maxError);
+            history.pop_front();
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatSinCos]")
+{
+    VFloatSinCos* top = new VFloatSinCos { new VerilatedContext };
+    top->ce = 1;
+    Result r;
+
+    // sin(0) = 0, cos(0) = 1
+    r = calcSinCos(top, 0x00000000);
+    REQUIRE(r.sin == 0x00000000);
+    REQUIRE(r.cos == 0x3f800000);
+
+    // sin(-0) = -0, cos(-0) = 1
+    r = calcSinCos(top, 0x80000000);
+    REQUIRE(r.sin == 0x80000000);
+    REQUIRE(r.cos == 0x3f800000);
+
+    // sin(x) = x for very small x
+    r = calcSinCos(top, 0x38000000);
+    REQUIRE(r.sin == 0x38000000);
+    REQUIRE(r.cos == 0x3f800000);
+
+    // sin(pi / 2) = 1, cos(pi / 2) = 0
+    r = calcSinCos(top, 0x3fc90fdb);
+    REQUIRE(std::fabs(toFloat(r.sin) - 1.0) < MAX_ABS_ERROR);
+    REQUIRE(std::fabs(toFloat(r.cos)) < MAX_ABS_ERROR);
+
+    // sin(-pi) = 0, cos(-pi) = -1
+    r = calcSinCos(top, 0xc0490fdb);
+    REQUIRE(std::fabs(toFloat(r.sin)) < MAX_ABS_ERROR);
+    REQUIRE(std::fabs(toFloat(r.cos) + 1.0) < MAX_ABS_ERROR);
+
+    // sin(Inf) = NaN
+    r = calcSinCos(top, 0x7f800000);
+    REQUIRE(r.sin == 0x7fffffff);
+    REQUIRE(r.cos == 0x7fffffff);
+
+    // sin(-Inf) = NaN
+    r = calcSinCos(top, 0xff800000);
+    REQUIRE(r.sin == 0x7fffffff);
+    REQUIRE(r.cos == 0x7fffffff);
+
+    // sin(NaN) = NaN
+    r = calcSinCos(top, 0x7fc00000);
+    REQUIRE(r.sin == 0x7fffffff);
+    REQUIRE(r.cos == 0x7fffffff);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatSinCos]")
+{
+    VFloatSinCos* top = new VFloatSinCos { new VerilatedContext };
+    top->ce = 1;
+
+    // Clear the pipeline with sin(0) = 0
+    calcSinCos(top, 0x00000000);
+
+    top->in = 0x3fc90fdb; // sin(pi / 2)
+    for (uint32_t i = 0; i < LATENCY - 1; i++)
+    {
+        clk(top);
+        REQUIRE(top->sin == 0x00000000);
+    }
+
+    top->ce = 0;
+    clk(top);
+    REQUIRE(top->sin == 0x00000000);
+
+    top->ce = 1;
+    clk(top);
+    REQUIRE(std::fabs(toFloat(top->sin) - 1.0) < MAX_ABS_ERROR);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,173 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <cmath>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatUnpackedTest.h"
+
+void clk(VFloatUnpackedTest* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+// The longest path (unpack, add, pack) has a latency of 5 clocks
+void calc(VFloatUnpackedTest* top, float a, float b)
+{
+    top->aIn = *(uint32_t*)&a;
+    top->bIn = *(uint32_t*)&b;
+    for (int i = 0; i < 5; i++)
+    {
+        clk(top);
+    }
+}
+
+// Distance in units in the last place. Only valid when both numbers have the same sign.
+int64_t ulpDiff(uint32_t a, float b)
+{
+    return std::abs((int64_t)a - (int64_t)*(uint32_t*)&b);
+}
+
+float randomFloat(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> dist { 1.0f, 2.0f };
+    std::uniform_int_distribution<int> exponent { -40, 40 };
+    float f = std::ldexp(dist(rng), exponent(rng));
+    return (rng() & 1) ? -f : f;
+}
+
+TEST_CASE("Round trip", "[FloatUnpacked]")
+{
+    VFloatUnpackedTest* top = new VFloatUnpackedTest { new VerilatedContext };
+    top->ce = 1;
+
+    // Stream all numbers (except inf and NaN) with a stride through the pack and unpack modules
+    int pipelineCounter = 1;
+    uint32_t history[2] = { 0, 0 };
+    for (uint64_t i = 0; i < 0x100000000ull; i += 0x7f)
+    {
+        uint32_t in = (uint32_t)i;
+        if ((in & 0x7f800000) == 0x7f800000)
+            continue;
+        top->aIn = in;
+        top->bIn = 0;
+        clk(top);
+        history[1] = history[0];
+        history[0] = in;
+        if (pipelineCounter == 0)
+            REQUIRE(top->roundTrip == history[1]);
+        else
+            pipelineCounter--;
+    }
+
+    // All denormalized numbers with a small mantissa
+    for (uint32_t i = 0; i < 0x10000; i++)
+    {
+        calc(top, *(float*)&i, 0.0f);
+        REQUIRE(top->roundTrip == i);
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Random numbers", "[FloatUnpacked]")
+{
+    VFloatUnpackedTest* top = new VFloatUnpackedTest { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    top->ce = 1;
+
+    for (int i = 0; i < 200000; i++)
+    {
+        const float a = randomFloat(rng);
+        const float b = randomFloat(rng);
+        calc(top, a, b);
+
+        // The multiplication truncates, the result is rounded in the pack step
+        REQUIRE(ulpDiff(top->prod, a * b) <= 1);
+        if ((a + b) != 0.0f)
+        {
+            REQUIRE(ulpDiff(top->sum, a + b) <= 1);
+        }
+        if ((a - b) != 0.0f)
+        {
+            REQUIRE(ulpDiff(top->diff, a - b) <= 1);
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatUnpacked]")
+{
+    VFloatUnpackedTest* top = new VFloatUnpackedTest { new VerilatedContext };
+    top->ce = 1;
+
+    // 2.0 * 3.0 = 6.0, 2.0 + 3.0 = 5.0, 2.0 - 3.0 = -1.0
+    calc(top, 2.0f, 3.0f);
+    REQUIRE(top->prod == 0x40c00000);
+    REQUIRE(top->sum == 0x40a00000);
+    REQUIRE(top->diff == 0xbf800000);
+
+    // x - x = 0
+    calc(top, 3.14159265f, 3.14159265f);
+    REQUIRE(top->diff == 0x0);
+
+    // 0 * x = 0 and 0 + x = x
+    calc(top, 0.0f, 3.14159265f);
+    REQUIRE(top->prod == 0x0);
+    REQUIRE(top->sum == 0x40490fdb);
+
+    // 1.1754942E-38 * 0.5 = 5.877471E-39 (denormalized result)
+    calc(top, 1.1754942E-38f, 0.5f);
+    REQUIRE(top->prod == 0x003fffff + 1); // Rounded
+
+    // 1.84467440737e+19 * 1.84467440737e+19 = inf
+    calc(top, 1.84467440737e+19f, 1.84467440737e+19f);
+    REQUIRE(top->prod == 0x7f800000);
+
+    // 3.4028235E38 + 3.4028235E38 = inf
+    calc(top, 3.4028235E38f, 3.4028235E38f);
+    REQUIRE(top->sum == 0x7f800000);
+
+    // 1.0E-30 * 1.0E-30 = 0
+    calc(top, 1.0E-30f, 1.0E-30f);
+    REQUIRE(top->prod == 0x0);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
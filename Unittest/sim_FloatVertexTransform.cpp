@@ -0,0 +1,227 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Include model header, generated from Verilating "top.v"
+#include "VFloatVertexTransform.h"
+
+#ifndef TEST_MUL_DELAY
+#define TEST_MUL_DELAY 2
+#endif
+static constexpr uint32_t LATENCY = (2 * (2 + TEST_MUL_DELAY)) + 8 + 11;
+
+using Matrix = std::array<float, 16>; // Row major
+using Vertex = std::array<float, 4>;
+
+void clk(VFloatVertexTransform* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+float toFloat(uint32_t u)
+{
+    return *(float*)&u;
+}
+
+uint32_t toUint(float f)
+{
+    return *(uint32_t*)&f;
+}
+
+void loadMatrix(VFloatVertexTransform* top, const Matrix& m)
+{
+    const uint8_t ce = top->ce;
+    top->ce = 0;
+    top->matrixWe = 1;
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        top->matrixAddr = i;
+        top->matrixIn = toUint(m[i]);
+        clk(top);
+    }
+    top->matrixWe = 0;
+    top->ce = ce;
+}
+
+// Streams the vertices through the pipeline and returns { x, y, z, invW } per vertex.
+// ceRate is the probability in percent that ce is set.
+std::vector<std::array<uint32_t, 4>> runTransform(VFloatVertexTransform* top, const std::vector<Vertex>& vertices, uint32_t ceRate, std::mt19937& rng)
+{
+    std::vector<std::array<uint32_t, 4>> results;
+    uint32_t sent = 0;
+    while (results.size() < vertices.size())
+    {
+        const Vertex v = (sent < vertices.size()) ? vertices[sent] : Vertex { 0.0f, 0.0f, 0.0f, 1.0f };
+        top->ce = (rng() % 100) < ceRate;
+        top->inX = toUint(v[0]);
+        top->inY = toUint(v[1]);
+        top->inZ = toUint(v[2]);
+        top->inW = toUint(v[3]);
+        top->eval();
+        if (top->ce)
+        {
+            if (sent >= LATENCY)
+                results.push_back({ top->outX, top->outY, top->outZ, top->outInvW });
+            sent++;
+        }
+        clk(top);
+    }
+    return results;
+}
+
+// Every component of the transformation has the error of three additions and a truncated product.
+// The error of w is amplified by the division. The FloatRecip has a relative error of about 1e-6.
+void checkTransform(const Matrix& m, const std::vector<Vertex>& vertices, const std::vector<std::array<uint32_t, 4>>& results, double& maxError)
+{
+    for (uint32_t i = 0; i < vertices.size(); i++)
+    {
+        double transformed[4];
+        double magnitude[4];
+        for (uint32_t r = 0; r < 4; r++)
+        {
+            transformed[r] = 0.0;
+            magnitude[r] = 0.0;
+            for (uint32_t c = 0; c < 4; c++)
+            {
+                transformed[r] += (double)m[(r * 4) + c] * vertices[i][c];
+                magnitude[r] += std::fabs((double)m[(r * 4) + c] * vertices[i][c]);
+            }
+        }
+        const double w = transformed[3];
+        const double wError = magnitude[3] * std::ldexp(4.0, -23) / std::fabs(w);
+        for (uint32_t r = 0; r < 4; r++)
+        {
+            const double reference = (r < 3) ? transformed[r] / w : 1.0 / w;
+            const double componentError = (r < 3) ? (magnitude[r] * std::ldexp(4.0, -23) / std::fabs(w)) : 0.0;
+            const double bound = componentError + (std::fabs(reference) * (wError + 4e-6));
+            const double error = std::fabs((double)toFloat(results[i][r]) - reference);
+            REQUIRE(error <= bound);
+            maxError = std::fmax(maxError, error / bound);
+        }
+    }
+}
+
+// The w row is close to (0, 0, 0, 1), so that w stays positive and away from zero
+Matrix randomMatrix(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> dist { -2.0f, 2.0f };
+    std::uniform_real_distribution<float> small { -0.25f, 0.25f };
+    std::uniform_real_distribution<float> one { 1.0f, 2.0f };
+    Matrix m;
+    for (uint32_t i = 0; i < 12; i++)
+        m[i] = dist(rng);
+    m[12] = small(rng);
+    m[13] = small(rng);
+    m[14] = small(rng);
+    m[15] = one(rng);
+    return m;
+}
+
+std::vector<Vertex> randomVertices(std::mt19937& rng, uint32_t count)
+{
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    std::uniform_real_distribution<float> one { 1.0f, 2.0f };
+    std::vector<Vertex> vertices(count);
+    for (Vertex& v : vertices)
+        v = { dist(rng), dist(rng), dist(rng), one(rng) };
+    return vertices;
+}
+
+TEST_CASE("Random vertices", "[FloatVertexTransform]")
+{
+    VFloatVertexTransform* top = new VFloatVertexTransform { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+
+    double maxError = 0.0;
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        const Matrix m = randomMatrix(rng);
+        const std::vector<Vertex> vertices = randomVertices(rng, 2000);
+        loadMatrix(top, m);
+        checkTransform(m, vertices, runTransform(top, vertices, 100, rng), maxError);
+    }
+    std::printf("FloatVertexTransform (MUL_DELAY = %d): Max error %f of the bound\n", TEST_MUL_DELAY, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Specific numbers", "[FloatVertexTransform]")
+{
+    VFloatVertexTransform* top = new VFloatVertexTransform { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    double maxError = 0.0;
+
+    // The identity is loaded after the configuration
+    const Matrix identity { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    const std::vector<Vertex> vertices { { 2.0f, 4.0f, 6.0f, 2.0f }, { -3.0f, 1.5f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f, 4.0f } };
+    std::vector<std::array<uint32_t, 4>> results = runTransform(top, vertices, 100, rng);
+    checkTransform(identity, vertices, results, maxError);
+    REQUIRE(toFloat(results[1][2]) == 0.0f);
+
+    // Translation by (1, 2, 3) and a perspective projection with w = z
+    const Matrix projection { 1, 0, 0, 1, 0, 1, 0, 2, 0, 0, 1, 3, 0, 0, 1, 0 };
+    const std::vector<Vertex> points { { 1.0f, 1.0f, 1.0f, 1.0f }, { -2.0f, 4.0f, 5.0f, 1.0f }, { 0.5f, -0.5f, 0.25f, 1.0f } };
+    loadMatrix(top, projection);
+    results = runTransform(top, points, 100, rng);
+    checkTransform(projection, points, results, maxError);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[FloatVertexTransform]")
+{
+    VFloatVertexTransform* top = new VFloatVertexTransform { new VerilatedContext };
+    VFloatVertexTransform* stalled = new VFloatVertexTransform { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    const Matrix m = randomMatrix(rng);
+    const std::vector<Vertex> vertices = randomVertices(rng, 2000);
+    loadMatrix(top, m);
+    loadMatrix(stalled, m);
+
+    // The results are bit exact to the results without stalls
+    const std::vector<std::array<uint32_t, 4>> results = runTransform(top, vertices, 100, rng);
+    REQUIRE(runTransform(stalled, vertices, 60, rng) == results);
+
+    // Final model cleanup
+    top->final();
+    stalled->final();
+
+    // Destroy model
+    delete top;
+    delete stalled;
+}
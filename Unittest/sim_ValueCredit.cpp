@@ -0,0 +1,331 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <deque>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VValueCreditTest.h"
+
+// The harness is configured via the Makefile. LATENCY is the latency of the
+// pipeline in front of the FIFO, DEPTH the depth of the FIFO and THRESHOLD the
+// ALMOST_FULL_THRESHOLD of the ValueCredit.
+#ifndef TEST_LATENCY
+#define TEST_LATENCY 8
+#endif
+#ifndef TEST_DEPTH
+#define TEST_DEPTH 16
+#endif
+#ifndef TEST_THRESHOLD
+#define TEST_THRESHOLD 4
+#endif
+
+void clk(VValueCreditTest* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+void reset(VValueCreditTest* t)
+{
+    t->issue = 0;
+    t->outReady = 0;
+    t->resetn = 0;
+    // Hold the reset until all values have left the pipeline
+    for (uint32_t i = 0; i < TEST_LATENCY + 1; i++)
+    {
+        clk(t);
+    }
+    t->resetn = 1;
+    clk(t);
+}
+
+// Producer which reacts N = TEST_THRESHOLD clocks after 'almostFull' is set.
+// It checks every clock that the FIFO is never overflown, that the credits are
+// consistent with the values in the pipeline and in the FIFO and that all values
+// arrive in order.
+struct Producer
+{
+    std::deque<bool> almostFullHistory {};
+    std::deque<bool> issueHistory {};
+    uint32_t issued { 0 };
+    uint32_t received { 0 };
+
+    Producer(VValueCreditTest* t)
+        : almostFullHistory(TEST_THRESHOLD, t->almostFull)
+        , issueHistory(TEST_LATENCY, false)
+    {
+    }
+
+    bool step(VValueCreditTest* t, bool wantIssue, bool outReady)
+    {
+        const bool issue = wantIssue && !almostFullHistory.front();
+        almostFullHistory.pop_front();
+        almostFullHistory.push_back(t->almostFull);
+
+        REQUIRE(t->almostFull == (t->credits <= TEST_THRESHOLD));
+        REQUIRE(t->creditAvailable == (t->credits != 0));
+        if (issue)
+        {
+            REQUIRE(t->creditAvailable);
+        }
+        if (t->fifoInValid)
+        {
+            REQUIRE(!t->fifoFull);
+        }
+
+        t->issue = issue;
+        t->in = issued;
+        t->outReady = outReady;
+        if (t->outValid && outReady)
+        {
+            REQUIRE(t->out == received);
+            received++;
+        }
+        if (issue)
+        {
+            issued++;
+        }
+        clk(t);
+
+        // Every value in the pipeline or in the FIFO holds a credit
+        issueHistory.pop_front();
+        issueHistory.push_back(issue);
+        uint32_t inPipeline = 0;
+        for (bool i : issueHistory)
+        {
+            inPipeline += i;
+        }
+        REQUIRE(t->credits + t->fifoFill + inPipeline == TEST_DEPTH);
+        REQUIRE(t->valueInPipeline == (t->credits != TEST_DEPTH));
+        return issue;
+    }
+
+    void drain(VValueCreditTest* t)
+    {
+        for (uint32_t i = 0; i < TEST_LATENCY + TEST_DEPTH + 2; i++)
+        {
+            step(t, false, true);
+        }
+        REQUIRE(received == issued);
+        REQUIRE(t->credits == TEST_DEPTH);
+        REQUIRE(t->valueInPipeline == 0);
+    }
+};
+
+TEST_CASE("Credits return on drain", "[ValueCredit]")
+{
+    VValueCreditTest* top = new VValueCreditTest { new VerilatedContext };
+    reset(top);
+
+    REQUIRE(top->credits == TEST_DEPTH);
+    REQUIRE(top->creditAvailable == 1);
+    REQUIRE(top->valueInPipeline == 0);
+
+    // Fill the FIFO completely without draining it
+    for (uint32_t i = 0; i < TEST_DEPTH; i++)
+    {
+        REQUIRE(top->creditAvailable == 1);
+        REQUIRE(top->credits == TEST_DEPTH - i);
+        top->issue = 1;
+        top->in = i;
+        clk(top);
+    }
+    top->issue = 0;
+    REQUIRE(top->credits == 0);
+    REQUIRE(top->creditAvailable == 0);
+    REQUIRE(top->valueInPipeline == 1);
+    for (uint32_t i = 0; i < TEST_LATENCY + 1; i++)
+    {
+        clk(top);
+    }
+    REQUIRE(top->fifoFill == TEST_DEPTH);
+    REQUIRE(top->credits == 0);
+
+    // Every drained value returns one credit
+    for (uint32_t i = 0; i < TEST_DEPTH; i++)
+    {
+        REQUIRE(top->outValid == 1);
+        REQUIRE(top->out == i);
+        top->outReady = 1;
+        clk(top);
+        REQUIRE(top->credits == i + 1);
+    }
+    top->outReady = 0;
+    REQUIRE(top->outValid == 0);
+    REQUIRE(top->creditAvailable == 1);
+    REQUIRE(top->valueInPipeline == 0);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Almost full at threshold", "[ValueCredit]")
+{
+    VValueCreditTest* top = new VValueCreditTest { new VerilatedContext };
+    reset(top);
+
+    for (uint32_t i = 0; i < TEST_DEPTH; i++)
+    {
+        REQUIRE(top->almostFull == (top->credits <= TEST_THRESHOLD));
+        top->issue = 1;
+        top->in = i;
+        clk(top);
+        REQUIRE(top->credits == TEST_DEPTH - i - 1);
+        REQUIRE(top->almostFull == (TEST_DEPTH - i - 1 <= TEST_THRESHOLD));
+    }
+    top->issue = 0;
+
+    // Draining one value above the threshold releases almostFull
+    for (uint32_t i = 0; i < TEST_LATENCY + 1; i++)
+    {
+        clk(top);
+    }
+    top->outReady = 1;
+    for (uint32_t i = 0; i < TEST_DEPTH; i++)
+    {
+        clk(top);
+        REQUIRE(top->credits == i + 1);
+        REQUIRE(top->almostFull == (i + 1 <= TEST_THRESHOLD));
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("One issue per clock with a reaction of THRESHOLD clocks", "[ValueCredit]")
+{
+    VValueCreditTest* top = new VValueCreditTest { new VerilatedContext };
+    reset(top);
+    Producer producer { top };
+
+    // The consumer is always ready. The producer must never be throttled.
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        REQUIRE(producer.step(top, true, true));
+    }
+    producer.drain(top);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Random backpressure", "[ValueCredit]")
+{
+    VValueCreditTest* top = new VValueCreditTest { new VerilatedContext };
+    std::mt19937 rng { 1234 };
+    reset(top);
+    Producer producer { top };
+
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        // Change between phases with a slow and a fast consumer
+        const uint32_t readyRate = ((i / 1000) & 1) ? 2 : 8;
+        producer.step(top, (rng() % 8) != 0, (rng() % 8) < readyRate);
+    }
+    REQUIRE(producer.issued > 10000);
+    producer.drain(top);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Issue without credit is ignored", "[ValueCredit]")
+{
+    VValueCreditTest* top = new VValueCreditTest { new VerilatedContext };
+    reset(top);
+
+    for (uint32_t i = 0; i < TEST_DEPTH; i++)
+    {
+        top->issue = 1;
+        clk(top);
+    }
+    REQUIRE(top->credits == 0);
+    REQUIRE(top->creditAvailable == 0);
+
+    // Violates the precondition of the ValueCredit. The counter must not wrap.
+    clk(top);
+    clk(top);
+    top->issue = 0;
+    REQUIRE(top->credits == 0);
+    REQUIRE(top->creditAvailable == 0);
+    REQUIRE(top->almostFull == 1);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("Reset while values are in flight", "[ValueCredit]")
+{
+    VValueCreditTest* top = new VValueCreditTest { new VerilatedContext };
+    std::mt19937 rng { 5678 };
+    reset(top);
+
+    {
+        Producer producer { top };
+        for (uint32_t i = 0; i < 1000; i++)
+        {
+            producer.step(top, true, rng() & 1);
+        }
+        REQUIRE(top->valueInPipeline == 1);
+    }
+
+    reset(top);
+    REQUIRE(top->credits == TEST_DEPTH);
+    REQUIRE(top->creditAvailable == 1);
+    REQUIRE(top->almostFull == (TEST_DEPTH <= TEST_THRESHOLD));
+    REQUIRE(top->valueInPipeline == 0);
+    REQUIRE(top->outValid == 0);
+    REQUIRE(top->fifoFill == 0);
+
+    // No value from before the reset must appear and the flow control starts again
+    Producer producer { top };
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        producer.step(top, true, rng() & 1);
+    }
+    producer.drain(top);
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
@@ -0,0 +1,94 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Include common routines
+#include <verilated.h>
+#include <vector>
+#include <random>
+
+// Include model header, generated from Verilating "top.v"
+#include "VValueDelay.h"
+
+// The delay is configured via the Makefile. The same test is executed for
+// the flip flop, the shift register LUT and the block RAM implementation.
+#ifndef TEST_DELAY
+#define TEST_DELAY 4
+#endif
+
+void clk(VValueDelay* t)
+{
+    t->clk = 0;
+    t->eval();
+    t->clk = 1;
+    t->eval();
+}
+
+TEST_CASE("Stream", "[ValueDelay]")
+{
+    VValueDelay* top = new VValueDelay { new VerilatedContext };
+    std::vector<uint32_t> history;
+    top->ce = 1;
+
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        top->in = i * 0x9e3779b9;
+        history.push_back(top->in);
+        clk(top);
+        if (history.size() >= TEST_DELAY)
+        {
+            REQUIRE(top->out == history[history.size() - TEST_DELAY]);
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
+
+TEST_CASE("CE stalls the pipeline", "[ValueDelay]")
+{
+    VValueDelay* top = new VValueDelay { new VerilatedContext };
+    std::vector<uint32_t> history;
+    std::mt19937 rng { 1234 };
+
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        top->ce = rng() & 1;
+        top->in = rng();
+        if (top->ce)
+        {
+            history.push_back(top->in);
+        }
+        clk(top);
+        if (history.size() >= TEST_DELAY)
+        {
+            REQUIRE(top->out == history[history.size() - TEST_DELAY]);
+        }
+    }
+
+    // Final model cleanup
+    top->final();
+
+    // Destroy model
+    delete top;
+}
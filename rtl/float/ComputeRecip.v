@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Module to calculate the reciprocal of a normalized number (1.0 ... 1.9999..). Other numbers are not supported.
 // Hint: As soon as a number is normalized (number is shifted to the right until the MSb is 1), it can be interpretet as 1.x,
 // Doesn't matter if it is an integer or only the fraction of a number.
@@ -28,7 +30,8 @@
 // Means two iterations resulting in 24bit precision.
 module ComputeRecip #(
     parameter MS = 25,
-    parameter ITR = 2
+    parameter ITR = 2,
+    localparam LATENCY = `COMPUTE_RECIP_LATENCY(ITR)
 )
 (
     input  wire                                 clk,
@@ -61,7 +64,7 @@ module ComputeRecip #(
         .x0(step0_mantissa)
     );
 
-    ValueDelay #(.VALUE_SIZE(MS), .DELAY(4)) 
+    ValueDelay #(.VALUE_SIZE(MS), .DELAY(`NEWTON_RAPHSON_ITERATION_INIT_LATENCY)) 
         step0mantissaNegative (.clk(clk), .ce(ce), .in(~d + { { ( MS - 1) { 1'b0 } }, 1'b1 }), .out(step0_mantissaDenumerator));
 
     ////////////////////////////////////////////////////////////////////////////
@@ -90,7 +93,7 @@ module ComputeRecip #(
                 .x1(step1_mantissa[i + 1])
             );
 
-            ValueDelay #(.VALUE_SIZE(MS), .DELAY(3)) 
+            ValueDelay #(.VALUE_SIZE(MS), .DELAY(`NEWTON_RAPHSON_ITERATION_LATENCY)) 
                 step1mantissaNegative (.clk(clk), .ce(ce), .in(step1_mantissaDenumerator[i]), .out(step1_mantissaDenumerator[i + 1]));
 
         end
@@ -103,7 +106,8 @@ endmodule
 // Clocks: 3
 module NewtonRaphsonIteration #(
     // Includes 1 Sign, 1 Integer and rest are the fraction bits. For a float 32 with 23 bit mantissa, this must be 25.
-    parameter MS = 25 // S1.23
+    parameter MS = 25, // S1.23
+    localparam LATENCY = `NEWTON_RAPHSON_ITERATION_LATENCY
 )
 (
     input  wire                                 clk,
@@ -160,7 +164,8 @@ endmodule
 module NewtonRaphsonIterationInit #(
     // Includes 1 Sign, 1 Integer and rest are the fraction bits. For a float 32 with 23 bit mantissa, this must be 25.
     parameter MS = 25, // S1.23
-    localparam FS = 18 // S3.14
+    localparam FS = 18, // S3.14
+    localparam LATENCY = `NEWTON_RAPHSON_ITERATION_INIT_LATENCY
 )
 (
     input  wire                         clk,
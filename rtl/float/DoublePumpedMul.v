@@ -0,0 +1,126 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Unsigned multiplier which calculates two independent products per clk with only one multiplier.
+// The multiplier runs with clk2x, which must have the double frequency of clk and must be
+// phase aligned to clk (for instance both generated by the same MMCM). On the edge of clk2x
+// in the middle of a clk cycle, the multiplier samples the operands of stream 0, on the edge
+// which is aligned to clk, it samples the operands of stream 1.
+// The multiplier part has no clock enable. It always calculates the products of its input
+// registers. To keep the behaviour of a pipeline which is stalled via ce, a skid register
+// keeps the products which would otherwise be lost when ce was low in the previous clk cycle.
+// This module is pipelined. It can calculate two multiplications per clk
+// This module has a latency of 3 clk cycles
+module DoublePumpedMul
+#(
+    parameter A_SIZE = 24,
+    parameter B_SIZE = 24,
+    localparam PROD_SIZE = A_SIZE + B_SIZE,
+    localparam LATENCY = `DOUBLE_PUMPED_MUL_LATENCY
+)
+(
+    input  wire                         clk,
+    input  wire                         clk2x,
+    input  wire                         ce,
+    input  wire [A_SIZE - 1 : 0]        a0,
+    input  wire [B_SIZE - 1 : 0]        b0,
+    input  wire [A_SIZE - 1 : 0]        a1,
+    input  wire [B_SIZE - 1 : 0]        b1,
+    output reg  [PROD_SIZE - 1 : 0]     prod0,
+    output reg  [PROD_SIZE - 1 : 0]     prod1
+);
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Input registers (clk)
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [A_SIZE - 1 : 0]       step0_a0;
+    reg  [B_SIZE - 1 : 0]       step0_b0;
+    reg  [A_SIZE - 1 : 0]       step0_a1;
+    reg  [B_SIZE - 1 : 0]       step0_b1;
+    reg                         step0_toggle = 0;
+    always @(posedge clk)
+    begin
+        if (ce)
+        begin
+            step0_a0 <= a0;
+            step0_b0 <= b0;
+            step0_a1 <= a1;
+            step0_b1 <= b1;
+        end
+        step0_toggle <= ~step0_toggle;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Multiplier (clk2x)
+    // The products of the operands in the input registers are available
+    // one clk cycle after the operands have been sampled.
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                         step1_toggle = 0;
+    reg  [A_SIZE - 1 : 0]       step1_a;
+    reg  [B_SIZE - 1 : 0]       step1_b;
+    reg  [PROD_SIZE - 1 : 0]    step1_prod;
+    reg  [PROD_SIZE - 1 : 0]    step1_prod0;
+    always @(posedge clk2x)
+    begin
+        // step0_toggle was just flipped by clk --> the current edge is in the middle of the clk cycle
+        if (step0_toggle != step1_toggle)
+        begin
+            step1_a <= step0_a0;
+            step1_b <= step0_b0;
+            // Product of stream 0 was calculated on the last edge, keep it till the end of the clk cycle
+            step1_prod0 <= step1_prod;
+        end
+        else
+        begin
+            step1_a <= step0_a1;
+            step1_b <= step0_b1;
+        end
+        step1_toggle <= step0_toggle;
+        step1_prod <= step1_a * step1_b;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Output registers (clk)
+    // When ce was low in the last cycle, the input registers where not updated
+    // and the multiplier already calculated the next products. In this case,
+    // use the products of the skid register.
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                         step2_ceLast = 0;
+    reg  [PROD_SIZE - 1 : 0]    step2_skid0;
+    reg  [PROD_SIZE - 1 : 0]    step2_skid1;
+    always @(posedge clk)
+    begin
+        if (step2_ceLast)
+        begin
+            step2_skid0 <= step1_prod0;
+            step2_skid1 <= step1_prod;
+        end
+        if (ce)
+        begin
+            prod0 <= (step2_ceLast) ? step1_prod0 : step2_skid0;
+            prod1 <= (step2_ceLast) ? step1_prod : step2_skid1;
+        end
+        step2_ceLast <= ce;
+    end
+endmodule
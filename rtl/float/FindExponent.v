@@ -15,10 +15,13 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 module FindExponent
 #(
     parameter EXPONENT_SIZE = 8,
-    parameter VALUE_SIZE = 23
+    parameter VALUE_SIZE = 23,
+    localparam LATENCY = 0 // Pure combinatorial logic
 )
 (
     input  wire [VALUE_SIZE - 1 : 0]    value,
@@ -0,0 +1,203 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Fixed point evaluation of a function f(x) in the range 0.0 <= x < 1.0
+// The range is divided into 2 ** TABLE_SIZE_LOG2 segments. For every segment, a table
+// (which can be mapped into a BRAM) contains the coefficients of a Taylor polynomial of
+// the degree DEGREE, which is developed at the start of the segment. The upper bits of x
+// select the segment, the lower bits are used to evaluate the polynomial in Horner form.
+// Every Horner step requires one multiplication and one clock.
+// The coefficients are calculated during the elaboration or loaded from a file.
+// FUNCTION selects the function:
+//  - "EXP2": 2 ** x (1.0 .. 2.0)
+//  - "LOG2": log2(1.0 + x) (0.0 .. 1.0)
+//  - "SIN":  sin(x * pi / 2) (0.0 .. 1.0)
+//  - "COS":  cos(x * pi / 2) (0.0 .. 1.0)
+//  - "FILE": The coefficients are loaded with $readmemh from COEFFICIENTS_FILE. Every line
+//    contains the coefficients of one segment, coefficient 0 in the LSBs. The polynomial is
+//    evaluated with the position in the segment (0.0 .. 1.0).
+// x is an unsigned fixed point number with X_SIZE fraction bits. y is a signed fixed point
+// number with FRACTION_SIZE fraction bits.
+// The error can be reduced by increasing the TABLE_SIZE_LOG2 or the DEGREE.
+// This module is pipelined. It can calculate one value per clock
+// This module has a latency of DEGREE + 1 clock cycles
+module FixedFunction
+#(
+    parameter FUNCTION = "EXP2",
+    parameter X_SIZE = 29, // Must be bigger than TABLE_SIZE_LOG2
+    parameter TABLE_SIZE_LOG2 = 8,
+    parameter DEGREE = 2,
+    parameter FRACTION_SIZE = 29,
+    parameter COEFFICIENTS_FILE = "",
+    localparam VALUE_SIZE = FRACTION_SIZE + 3, // Sign and two integer bits
+    localparam LATENCY = `FIXED_FUNCTION_LATENCY(DEGREE)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [X_SIZE - 1 : 0]        x,
+    output wire [VALUE_SIZE - 1 : 0]    y
+);
+    localparam TABLE_SIZE = 2 ** TABLE_SIZE_LOG2;
+    localparam U_SIZE = X_SIZE - TABLE_SIZE_LOG2; // Position of x in the segment
+    localparam COEFFICIENTS_SIZE = (DEGREE + 1) * VALUE_SIZE;
+    localparam real LN2 = 0.6931471805599453;
+    localparam real PI_HALF = 1.5707963267948966;
+
+    // Coefficient j of the polynomial of a segment. The polynomial is scaled, so that
+    // it is evaluated with the position in the segment (0.0 .. 1.0) instead of x.
+    function real coefficient;
+        input integer segment;
+        input integer j;
+        real a;
+        real c;
+        integer k;
+        begin
+            a = $itor(segment) / $itor(TABLE_SIZE);
+            if ((FUNCTION == "SIN") || (FUNCTION == "COS"))
+            begin
+                // The derivatives of sin and cos are sin and cos shifted by pi / 2
+                c = (FUNCTION == "SIN") ? $sin(PI_HALF * (a + $itor(j))) : $cos(PI_HALF * (a + $itor(j)));
+                for (k = 1; k <= j; k = k + 1)
+                begin
+                    c = c * PI_HALF / $itor(k);
+                end
+            end
+            else if (FUNCTION == "LOG2")
+            begin
+                if (j == 0)
+                begin
+                    c = $ln(1.0 + a) / LN2;
+                end
+                else
+                begin
+                    c = 1.0 / ($itor(j) * LN2 * ((1.0 + a) ** j));
+                    if ((j % 2) == 0)
+                    begin
+                        c = -c;
+                    end
+                end
+            end
+            else // EXP2
+            begin
+                c = 2.0 ** a;
+                for (k = 1; k <= j; k = k + 1)
+                begin
+                    c = c * LN2 / $itor(k);
+                end
+            end
+            coefficient = c / (2.0 ** (TABLE_SIZE_LOG2 * j));
+        end
+    endfunction
+
+    // Rounds a real number to the fixed point format
+    function [VALUE_SIZE - 1 : 0] realToFixed;
+        input real value;
+        real magnitude;
+        integer i;
+        begin
+            magnitude = (value < 0.0) ? -value : value;
+            magnitude = $floor((magnitude * (2.0 ** FRACTION_SIZE)) + 0.5);
+            for (i = VALUE_SIZE - 1; i >= 0; i = i - 1)
+            begin
+                realToFixed[i] = magnitude >= (2.0 ** i);
+                if (realToFixed[i])
+                begin
+                    magnitude = magnitude - (2.0 ** i);
+                end
+            end
+            if (value < 0.0)
+            begin
+                realToFixed = ~realToFixed + 1;
+            end
+        end
+    endfunction
+
+    (* rom_style = "block" *) reg [COEFFICIENTS_SIZE - 1 : 0] coefficientTable [0 : TABLE_SIZE - 1];
+    initial
+    begin : InitTable
+        integer i;
+        integer j;
+        if (FUNCTION == "FILE")
+        begin
+            $readmemh(COEFFICIENTS_FILE, coefficientTable);
+        end
+        else
+        begin
+            for (i = 0; i < TABLE_SIZE; i = i + 1)
+            begin
+                for (j = 0; j <= DEGREE; j = j + 1)
+                begin
+                    coefficientTable[i][j * VALUE_SIZE +: VALUE_SIZE] = realToFixed(coefficient(i, j));
+                end
+            end
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Read the coefficients of the segment
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [COEFFICIENTS_SIZE - 1 : 0]    one_coefficients;
+    reg  [U_SIZE - 1 : 0]               one_u;
+    always @(posedge clk)
+    if (ce) begin
+        one_coefficients <= coefficientTable[x[U_SIZE +: TABLE_SIZE_LOG2]];
+        one_u <= x[0 +: U_SIZE];
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Horner: acc = (acc * u) + c[j]
+    // Clocks: DEGREE
+    ////////////////////////////////////////////////////////////////////////////
+    wire [((DEGREE + 1) * VALUE_SIZE) - 1 : 0]          accs;
+    wire [((DEGREE + 1) * U_SIZE) - 1 : 0]              us;
+    wire [((DEGREE + 1) * COEFFICIENTS_SIZE) - 1 : 0]   coefficients;
+
+    assign accs[0 +: VALUE_SIZE] = one_coefficients[DEGREE * VALUE_SIZE +: VALUE_SIZE];
+    assign us[0 +: U_SIZE] = one_u;
+    assign coefficients[0 +: COEFFICIENTS_SIZE] = one_coefficients;
+
+    generate
+        genvar k;
+        for (k = 0; k < DEGREE; k = k + 1)
+        begin : Horner
+            reg  [VALUE_SIZE - 1 : 0]           acc;
+            reg  [U_SIZE - 1 : 0]               u;
+            reg  [COEFFICIENTS_SIZE - 1 : 0]    c;
+            always @(posedge clk)
+            if (ce) begin : Step
+                reg signed [VALUE_SIZE + U_SIZE : 0] prod;
+
+                prod = $signed(accs[k * VALUE_SIZE +: VALUE_SIZE]) * $signed({ 1'b0, us[k * U_SIZE +: U_SIZE] });
+                acc <= prod[U_SIZE +: VALUE_SIZE] 
+                    + coefficients[(k * COEFFICIENTS_SIZE) + ((DEGREE - 1 - k) * VALUE_SIZE) +: VALUE_SIZE];
+                u <= us[k * U_SIZE +: U_SIZE];
+                c <= coefficients[k * COEFFICIENTS_SIZE +: COEFFICIENTS_SIZE];
+            end
+            assign accs[(k + 1) * VALUE_SIZE +: VALUE_SIZE] = acc;
+            assign us[(k + 1) * U_SIZE +: U_SIZE] = u;
+            assign coefficients[(k + 1) * COEFFICIENTS_SIZE +: COEFFICIENTS_SIZE] = c;
+        end
+    endgenerate
+
+    assign y = accs[DEGREE * VALUE_SIZE +: VALUE_SIZE];
+endmodule
@@ -0,0 +1,265 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point addition of three numbers (a + b + c)
+// Compared to two chained FloatAdds, the three numbers share one exponent compare and are
+// added with a carry save adder, followed by a single normalization and rounding.
+// The two smaller numbers are aligned in parallel to the biggest exponent. Bits which are
+// shifted out behind the GUARD_SIZE guard bits are truncated. The result is rounded to
+// nearest (ties away from zero).
+// When the exponents differ by at most GUARD_SIZE, no bits are truncated and the result is
+// correctly rounded. Otherwise both truncated numbers contribute an error below one guard
+// bit of the biggest number. Without an overflow, the error is bounded by
+//     |sum - (a + b + c)| <= 2^-(MANTISSA_SIZE + GUARD_SIZE - 1) * max(|a|, |b|, |c|) + 0.5 ulp(sum)
+// With cancellation, this bound can be much bigger than the result. For instance,
+// 1.0 + -1.0 + 2^-30 returns +0, while two chained FloatAdds return 2^-30.
+// A zero result is always a positive zero. When one of the inputs is Inf or NaN, the
+// result is Inf (or NaN when one of the inputs is a NaN). The sign of the result is then
+// the sign of the sum.
+// This module is pipelined. It can calculate one addition of three numbers per clock
+// This module has a latency of 4 clock cycles
+module FloatAdd3
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 3,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_ADD3_LATENCY
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] aIn,
+    input  wire [FLOAT_SIZE - 1 : 0] bIn,
+    input  wire [FLOAT_SIZE - 1 : 0] cIn,
+    output reg  [FLOAT_SIZE - 1 : 0] sum
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+    localparam EXPONENT_MAX = (2 ** EXPONENT_SIZE) - 1; // Inf and NaN
+
+    localparam ALIGNED_SIZE = 1 + MANTISSA_SIZE + GUARD_SIZE; // Mantissa with the leading one and guard bits (0.0 .. 1.999..)
+    localparam ONE_POS = MANTISSA_SIZE + GUARD_SIZE;
+    localparam SUM_SIZE = ALIGNED_SIZE + 2; // Sum of three mantissas has 3 integer bits (0.0 .. 5.999..)
+    localparam SUM_CALC_SIZE = SUM_SIZE + 1; // Add sign
+    localparam SUM_TOP_POS = SUM_SIZE - 1;
+    localparam LEADING_ONE_SIZE = $clog2(SUM_SIZE) + 1;
+    localparam LEADING_ONE_INVALID_VALUE = (2 ** LEADING_ONE_SIZE) - 1;
+    localparam EXPONENT_CALC_SIZE = EXPONENT_SIZE + 2; // Add one bit for the normalization and one for the rounding
+    localparam PACKED_SIZE = EXPONENT_CALC_SIZE + MANTISSA_SIZE;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Find the biggest exponent and align all mantissas to it.
+    // The mantissa of the number with the biggest exponent is not shifted.
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [2 : 0]                        one_signs;
+    reg  [(3 * ALIGNED_SIZE) - 1 : 0]   one_mantissas;
+    reg  [EXPONENT_SIZE - 1 : 0]        one_exponent;
+    reg                                 one_special;
+    reg                                 one_nan;
+    always @(posedge clk)
+    if (ce) begin : Align
+        integer i;
+        reg  [FLOAT_SIZE - 1 : 0]       numbers [0 : 2];
+        reg  [EXPONENT_SIZE - 1 : 0]    exponents [0 : 2];
+        reg  [EXPONENT_SIZE - 1 : 0]    maxExponent;
+        reg  [EXPONENT_SIZE - 1 : 0]    exponentDiff;
+        reg  [ALIGNED_SIZE - 1 : 0]     mantissa;
+
+        numbers[0] = aIn;
+        numbers[1] = bIn;
+        numbers[2] = cIn;
+
+        one_special <= 0;
+        one_nan <= 0;
+        for (i = 0; i < 3; i = i + 1)
+        begin
+            // Denormalized numbers have the same scale as numbers with an exponent of 1
+            exponents[i] = (numbers[i][EXPONENT_POS +: EXPONENT_SIZE] == 0) 
+                ? { { (EXPONENT_SIZE - 1) { 1'b0 } }, 1'b1 } 
+                : numbers[i][EXPONENT_POS +: EXPONENT_SIZE];
+            if (numbers[i][EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE])
+            begin
+                one_special <= 1;
+                if (numbers[i][MANTISSA_POS +: MANTISSA_SIZE] != 0)
+                begin
+                    one_nan <= 1;
+                end
+            end
+        end
+
+        // The three compares are independent and can be calculated in parallel
+        if ((exponents[0] >= exponents[1]) && (exponents[0] >= exponents[2]))
+        begin
+            maxExponent = exponents[0];
+        end
+        else if (exponents[1] >= exponents[2])
+        begin
+            maxExponent = exponents[1];
+        end
+        else
+        begin
+            maxExponent = exponents[2];
+        end
+
+        for (i = 0; i < 3; i = i + 1)
+        begin
+            exponentDiff = maxExponent - exponents[i];
+            mantissa = { numbers[i][EXPONENT_POS +: EXPONENT_SIZE] != 0, numbers[i][MANTISSA_POS +: MANTISSA_SIZE], { GUARD_SIZE { 1'b0 } } };
+            if (exponentDiff >= ALIGNED_SIZE[0 +: EXPONENT_SIZE])
+            begin
+                one_mantissas[i * ALIGNED_SIZE +: ALIGNED_SIZE] <= 0;
+            end
+            else
+            begin
+                one_mantissas[i * ALIGNED_SIZE +: ALIGNED_SIZE] <= mantissa >> exponentDiff;
+            end
+            one_signs[i] <= numbers[i][SIGN_POS];
+        end
+        one_exponent <= maxExponent;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Add the mantissas with a carry save adder and a single carry propagate adder
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                             two_sumSign;
+    reg  [SUM_SIZE - 1 : 0]         two_sumMantissa;
+    reg  [EXPONENT_SIZE - 1 : 0]    two_exponent;
+    reg                             two_special;
+    reg                             two_nan;
+    always @(posedge clk)
+    if (ce) begin : Calc
+        integer i;
+        reg  [SUM_CALC_SIZE - 1 : 0] mantissaSigned [0 : 2];
+        reg  [SUM_CALC_SIZE - 1 : 0] partialSum;
+        reg  [SUM_CALC_SIZE - 1 : 0] partialCarry;
+        reg  [SUM_CALC_SIZE - 1 : 0] sumMantissa;
+
+        // Convert unsigned numbers into signed numbers
+        for (i = 0; i < 3; i = i + 1)
+        begin
+            mantissaSigned[i] = { 3'b0, one_mantissas[i * ALIGNED_SIZE +: ALIGNED_SIZE] };
+            if (one_signs[i])
+            begin
+                mantissaSigned[i] = ~mantissaSigned[i] + 1;
+            end
+        end
+
+        // Carry save adder: Reduces the three numbers to two numbers without carry propagation
+        partialSum = mantissaSigned[0] ^ mantissaSigned[1] ^ mantissaSigned[2];
+        partialCarry = ((mantissaSigned[0] & mantissaSigned[1]) 
+            | (mantissaSigned[0] & mantissaSigned[2]) 
+            | (mantissaSigned[1] & mantissaSigned[2])) << 1;
+
+        sumMantissa = partialSum + partialCarry;
+
+        // Convert the signed sum back into an unsigned number
+        two_sumSign <= sumMantissa[SUM_CALC_SIZE - 1];
+        if (sumMantissa[SUM_CALC_SIZE - 1])
+        begin
+            sumMantissa = ~sumMantissa + 1;
+        end
+        two_sumMantissa <= sumMantissa[0 +: SUM_SIZE];
+        two_exponent <= one_exponent;
+        two_special <= one_special;
+        two_nan <= one_nan;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Find the leading one
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [LEADING_ONE_SIZE - 1 : 0] leadingOne;
+    FindExponent #(.EXPONENT_SIZE(LEADING_ONE_SIZE), .VALUE_SIZE(SUM_SIZE)) findExponent (two_sumMantissa, leadingOne);
+
+    reg                             three_sumSign;
+    reg  [SUM_SIZE - 1 : 0]         three_sumMantissa;
+    reg  [EXPONENT_SIZE - 1 : 0]    three_exponent;
+    reg  [LEADING_ONE_SIZE - 1 : 0] three_leadingOne;
+    reg                             three_special;
+    reg                             three_nan;
+    always @(posedge clk)
+    if (ce) begin
+        three_sumSign <= two_sumSign;
+        three_sumMantissa <= two_sumMantissa;
+        three_exponent <= two_exponent;
+        three_leadingOne <= leadingOne;
+        three_special <= two_special;
+        three_nan <= two_nan;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Normalize, round and pack the sum
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    always @(posedge clk)
+    if (ce) begin : Pack
+        reg  [EXPONENT_CALC_SIZE - 1 : 0]   exponent;
+        reg  [EXPONENT_CALC_SIZE - 1 : 0]   exponentBias;
+        reg  [EXPONENT_CALC_SIZE - 1 : 0]   leadingOnePos;
+        reg  [EXPONENT_CALC_SIZE - 1 : 0]   shift;
+        reg  [SUM_SIZE - 1 : 0]             mantissa;
+        reg  [PACKED_SIZE - 1 : 0]          packed;
+
+        exponentBias = { 2'b0, three_exponent };
+        leadingOnePos = { { (EXPONENT_CALC_SIZE - LEADING_ONE_SIZE) { 1'b0 } }, three_leadingOne };
+
+        // Shift the leading one to the MSB of the mantissa
+        if ((exponentBias + leadingOnePos) > ONE_POS[0 +: EXPONENT_CALC_SIZE])
+        begin
+            shift = SUM_TOP_POS[0 +: EXPONENT_CALC_SIZE] - leadingOnePos;
+            exponent = (exponentBias + leadingOnePos) - ONE_POS[0 +: EXPONENT_CALC_SIZE];
+        end
+        // The sum is a denormalized number. Shift it only up to the smallest exponent.
+        else
+        begin
+            shift = exponentBias + 1;
+            exponent = 0;
+        end
+        mantissa = three_sumMantissa << shift;
+
+        // Round to nearest. An overflow of the mantissa increments the exponent.
+        packed = { exponent, mantissa[SUM_TOP_POS - 1 -: MANTISSA_SIZE] } 
+            + { { (PACKED_SIZE - 1) { 1'b0 } }, mantissa[SUM_TOP_POS - 1 - MANTISSA_SIZE] };
+
+        if (three_special)
+        begin
+            sum <= { three_sumSign, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { three_nan } } };
+        end
+        else if (three_leadingOne == LEADING_ONE_INVALID_VALUE[0 +: LEADING_ONE_SIZE])
+        begin
+            sum <= 0;
+        end
+        else if (packed[MANTISSA_SIZE +: EXPONENT_CALC_SIZE] >= EXPONENT_MAX[0 +: EXPONENT_CALC_SIZE])
+        begin
+            sum <= { three_sumSign, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b0 } } };
+        end
+        else
+        begin
+            sum <= { three_sumSign, packed[MANTISSA_SIZE +: EXPONENT_SIZE], packed[0 +: MANTISSA_SIZE] };
+        end
+    end
+endmodule
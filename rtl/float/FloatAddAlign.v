@@ -0,0 +1,110 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// First step of the floating point addition (see FloatAdd)
+// Compares the exponents of both numbers and aligns the mantissa of the small number
+// to the exponent of the big number. The result only depends on the magnitudes of the
+// numbers. The signs are just passed through, therefore the alignment can be shared
+// between an addition and a substraction (see FloatAddSub). bigIsB signals, that bIn was
+// selected as big number.
+// This module is pipelined. It can align one pair of numbers per clock
+// This module has a latency of 1 clock cycle
+module FloatAddAlign
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam MANTISSA_CALC_SIZE = MANTISSA_SIZE + 3, // Adding sign, first digit, one bit for overflow
+    localparam LATENCY = `FLOAT_ADD_ALIGN_LATENCY
+)
+(
+    input  wire                               clk,
+    input  wire                               ce,
+    input  wire [FLOAT_SIZE - 1 : 0]          aIn,
+    input  wire [FLOAT_SIZE - 1 : 0]          bIn,
+
+    output reg                                bigIsB,
+    output reg                                bigNumberSign,
+    output reg                                smallNumberSign,
+    output reg  [EXPONENT_SIZE - 1 : 0]       bigNumberExponent,
+    output reg  [EXPONENT_SIZE - 1 : 0]       smallNumberExponent,
+    output reg  [MANTISSA_CALC_SIZE - 1 : 0]  bigNumberMantissa,
+    output reg  [MANTISSA_CALC_SIZE - 1 : 0]  smallNumberMantissa,
+    output reg  [MANTISSA_CALC_SIZE - 1 : 0]  smallNumberMantissaDenormalized,
+    output reg  [EXPONENT_SIZE - 1 : 0]       exponentDiff,
+    output reg                                exponentDiffGreaterZero
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+    localparam MANTISSA_WIDTH_LOG2 = $clog2(MANTISSA_SIZE);
+
+    always @(posedge clk)
+    if (ce) begin : UnpackAndAdapt
+        reg  [FLOAT_SIZE - 1 : 0]         bigNumber;
+        reg  [FLOAT_SIZE - 1 : 0]         smallNumber;
+        reg                               expSmallGreaterThanZero;
+        reg                               expBigGreaterThanZero;
+        reg  [EXPONENT_SIZE - 1 : 0]      diff;
+        reg  [MANTISSA_CALC_SIZE - 1 : 0] smallMantissa;
+
+        // The addition requires that we have the same exponent for the big and small number.
+        // Usually the small number will be adapted to the big number.
+        if (aIn[EXPONENT_POS +: EXPONENT_SIZE] < bIn[EXPONENT_POS +: EXPONENT_SIZE])
+        begin
+            bigNumber = bIn;
+            smallNumber = aIn;
+            bigIsB <= 1;
+        end
+        else 
+        begin
+            bigNumber = aIn;
+            smallNumber = bIn;
+            bigIsB <= 0;
+        end
+
+        expSmallGreaterThanZero = smallNumber[EXPONENT_POS +: EXPONENT_SIZE] > 0;
+        expBigGreaterThanZero = bigNumber[EXPONENT_POS +: EXPONENT_SIZE] > 0;
+
+        // Denormalize the small mantissa to enable the summerization with the big exponent
+        diff = bigNumber[EXPONENT_POS +: EXPONENT_SIZE] - smallNumber[EXPONENT_POS +: EXPONENT_SIZE];
+        // The timing here is really stressed. A fifth pipeline step could reduce stress here ...
+        if (diff >= MANTISSA_SIZE[0 +: EXPONENT_SIZE])
+        begin
+            // If the small number is too small, set everything to zero
+            smallMantissa = 0;
+            smallNumberMantissaDenormalized <= 0;
+        end
+        else 
+        begin
+            // If the small number is big enough for summerization, denormalize it!
+            smallMantissa = {2'b0, expSmallGreaterThanZero, smallNumber[MANTISSA_POS +: MANTISSA_SIZE]};
+            smallNumberMantissaDenormalized <= smallMantissa >>> diff[0 +: MANTISSA_WIDTH_LOG2];
+        end
+
+        bigNumberExponent <= bigNumber[EXPONENT_POS +: EXPONENT_SIZE];
+        smallNumberExponent <= smallNumber[EXPONENT_POS +: EXPONENT_SIZE];
+        bigNumberMantissa <= {2'b0, expBigGreaterThanZero, bigNumber[MANTISSA_POS +: MANTISSA_SIZE]};
+        smallNumberMantissa <= smallMantissa;
+        exponentDiff <= diff;
+        exponentDiffGreaterZero <= diff > 0;
+        bigNumberSign <= bigNumber[SIGN_POS];
+        smallNumberSign <= smallNumber[SIGN_POS];
+    end
+endmodule
@@ -0,0 +1,108 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point addition and substraction of the same operands (butterfly)
+// Calculates sum = a + b and diff = a - b. The exponent compare and the alignment of
+// the small mantissa only depend on the magnitudes of the numbers. Therefore one
+// FloatAddAlign is shared by both operations. Only the adders and the normalization
+// (FloatAddNormalize) are instantiated twice.
+// The results are bit exact to the FloatAdd and the FloatSub.
+// This module is pipelined. It can calculate one addition and one substraction per clock
+// This module has a latency of 4 clock cycles
+module FloatAddSub
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter ENABLE_OPTIMIZATION = 0,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_ADD_SUB_LATENCY
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] aIn,
+    input  wire [FLOAT_SIZE - 1 : 0] bIn,
+    output wire [FLOAT_SIZE - 1 : 0] sum,
+    output wire [FLOAT_SIZE - 1 : 0] diff
+);
+    localparam MANTISSA_CALC_SIZE = MANTISSA_SIZE + 3; // Adding sign, first digit, one bit for overflow
+
+    wire                                bigIsB;
+    wire                                bigNumberSign;
+    wire                                smallNumberSign;
+    wire [EXPONENT_SIZE - 1 : 0]        bigNumberExponent;
+    wire [EXPONENT_SIZE - 1 : 0]        smallNumberExponent;
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   bigNumberMantissa;
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   smallNumberMantissa;
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   smallNumberMantissaDenormalized;
+    wire [EXPONENT_SIZE - 1 : 0]        exponentDiff;
+    wire                                exponentDiffGreaterZero;
+
+    FloatAddAlign #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        align (
+            .clk(clk),
+            .ce(ce),
+            .aIn(aIn),
+            .bIn(bIn),
+            .bigIsB(bigIsB),
+            .bigNumberSign(bigNumberSign),
+            .smallNumberSign(smallNumberSign),
+            .bigNumberExponent(bigNumberExponent),
+            .smallNumberExponent(smallNumberExponent),
+            .bigNumberMantissa(bigNumberMantissa),
+            .smallNumberMantissa(smallNumberMantissa),
+            .smallNumberMantissaDenormalized(smallNumberMantissaDenormalized),
+            .exponentDiff(exponentDiff),
+            .exponentDiffGreaterZero(exponentDiffGreaterZero)
+        );
+
+    FloatAddNormalize #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .ENABLE_OPTIMIZATION(ENABLE_OPTIMIZATION))
+        add (
+            .clk(clk),
+            .ce(ce),
+            .bigNumberSign(bigNumberSign),
+            .smallNumberSign(smallNumberSign),
+            .bigNumberExponent(bigNumberExponent),
+            .smallNumberExponent(smallNumberExponent),
+            .bigNumberMantissa(bigNumberMantissa),
+            .smallNumberMantissa(smallNumberMantissa),
+            .smallNumberMantissaDenormalized(smallNumberMantissaDenormalized),
+            .exponentDiff(exponentDiff),
+            .exponentDiffGreaterZero(exponentDiffGreaterZero),
+            .sum(sum)
+        );
+
+    // For the substraction, the sign of b is inverted. Depending on the alignment,
+    // b is either the big or the small number.
+    FloatAddNormalize #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .ENABLE_OPTIMIZATION(ENABLE_OPTIMIZATION))
+        sub (
+            .clk(clk),
+            .ce(ce),
+            .bigNumberSign(bigNumberSign ^ bigIsB),
+            .smallNumberSign(smallNumberSign ^ !bigIsB),
+            .bigNumberExponent(bigNumberExponent),
+            .smallNumberExponent(smallNumberExponent),
+            .bigNumberMantissa(bigNumberMantissa),
+            .smallNumberMantissa(smallNumberMantissa),
+            .smallNumberMantissaDenormalized(smallNumberMantissaDenormalized),
+            .exponentDiff(exponentDiff),
+            .exponentDiffGreaterZero(exponentDiffGreaterZero),
+            .sum(diff)
+        );
+endmodule
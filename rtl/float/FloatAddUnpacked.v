@@ -0,0 +1,190 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point addition in the unpacked format (see FloatUnpack)
+// Compared to the FloatAdd, it saves the unpacking and the packing of the result.
+// The aligned mantissa of the smaller number is truncated.
+// This module is pipelined. It can calculate one addition per clock
+// This module has a latency of 3 clock cycles
+module FloatAddUnpacked
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    localparam UNPACKED_EXPONENT_SIZE = EXPONENT_SIZE + 2,
+    localparam UNPACKED_MANTISSA_SIZE = 2 + MANTISSA_SIZE + GUARD_SIZE,
+    localparam UNPACKED_SIZE = 1 + UNPACKED_EXPONENT_SIZE + UNPACKED_MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_ADD_UNPACKED_LATENCY
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [UNPACKED_SIZE - 1 : 0] aIn,
+    input  wire [UNPACKED_SIZE - 1 : 0] bIn,
+    output reg  [UNPACKED_SIZE - 1 : 0] sum
+);
+    localparam UNPACKED_MANTISSA_POS = 0;
+    localparam UNPACKED_EXPONENT_POS = UNPACKED_MANTISSA_SIZE;
+    localparam UNPACKED_SIGN_POS = UNPACKED_EXPONENT_POS + UNPACKED_EXPONENT_SIZE;
+
+    localparam EXPONENT_CALC_SIZE = UNPACKED_EXPONENT_SIZE + 1; // Add one bit for the difference and the normalization
+    localparam SUM_SIZE = UNPACKED_MANTISSA_SIZE + 1; // Sum of two mantissas has 3 integer bits (0.0 .. 7.999..)
+    localparam SUM_CALC_SIZE = SUM_SIZE + 1; // Add sign
+    localparam LEADING_ONE_SIZE = $clog2(SUM_SIZE) + 1;
+    localparam LEADING_ONE_INVALID_VALUE = (2 ** LEADING_ONE_SIZE) - 1;
+
+    localparam signed [EXPONENT_CALC_SIZE - 1 : 0] UNPACKED_EXPONENT_MIN = -(2 ** (UNPACKED_EXPONENT_SIZE - 1));
+    localparam signed [EXPONENT_CALC_SIZE - 1 : 0] UNPACKED_EXPONENT_MAX = (2 ** (UNPACKED_EXPONENT_SIZE - 1)) - 1;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Align the mantissa of the small number to the exponent of the big number
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                                     one_bigNumberSign;
+    reg                                     one_smallNumberSign;
+    reg  [UNPACKED_EXPONENT_SIZE - 1 : 0]   one_bigNumberExponent;
+    reg  [UNPACKED_MANTISSA_SIZE - 1 : 0]   one_bigNumberMantissa;
+    reg  [UNPACKED_MANTISSA_SIZE - 1 : 0]   one_smallNumberMantissa;
+    always @(posedge clk)
+    if (ce) begin : Align
+        reg  [UNPACKED_SIZE - 1 : 0]            bigNumber;
+        reg  [UNPACKED_SIZE - 1 : 0]            smallNumber;
+        reg  [EXPONENT_CALC_SIZE - 1 : 0]       exponentDiff;
+
+        // A zero has the smallest possible exponent, therefore it is always the small number
+        if ($signed(aIn[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE]) < $signed(bIn[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE]))
+        begin
+            bigNumber = bIn;
+            smallNumber = aIn;
+        end
+        else
+        begin
+            bigNumber = aIn;
+            smallNumber = bIn;
+        end
+
+        // Sign extend the exponents, the difference is always positive
+        exponentDiff = { bigNumber[UNPACKED_SIGN_POS - 1], bigNumber[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE] } 
+            - { smallNumber[UNPACKED_SIGN_POS - 1], smallNumber[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE] };
+
+        if (exponentDiff >= UNPACKED_MANTISSA_SIZE[0 +: EXPONENT_CALC_SIZE])
+        begin
+            one_smallNumberMantissa <= 0;
+        end
+        else
+        begin
+            one_smallNumberMantissa <= smallNumber[UNPACKED_MANTISSA_POS +: UNPACKED_MANTISSA_SIZE] >> exponentDiff;
+        end
+
+        one_bigNumberSign <= bigNumber[UNPACKED_SIGN_POS];
+        one_smallNumberSign <= smallNumber[UNPACKED_SIGN_POS];
+        one_bigNumberExponent <= bigNumber[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE];
+        one_bigNumberMantissa <= bigNumber[UNPACKED_MANTISSA_POS +: UNPACKED_MANTISSA_SIZE];
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Add the mantissas
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                                     two_sumSign;
+    reg  [SUM_SIZE - 1 : 0]                 two_sumMantissa;
+    reg  [UNPACKED_EXPONENT_SIZE - 1 : 0]   two_sumExponent;
+    always @(posedge clk)
+    if (ce) begin : Calc
+        reg  [SUM_CALC_SIZE - 1 : 0] bigNumberMantissaSigned;
+        reg  [SUM_CALC_SIZE - 1 : 0] smallNumberMantissaSigned;
+        reg  [SUM_CALC_SIZE - 1 : 0] sumMantissa;
+
+        // Convert unsigned numbers into signed numbers
+        bigNumberMantissaSigned = { 2'b0, one_bigNumberMantissa };
+        if (one_bigNumberSign)
+        begin
+            bigNumberMantissaSigned = ~bigNumberMantissaSigned + 1;
+        end
+
+        smallNumberMantissaSigned = { 2'b0, one_smallNumberMantissa };
+        if (one_smallNumberSign)
+        begin
+            smallNumberMantissaSigned = ~smallNumberMantissaSigned + 1;
+        end
+
+        sumMantissa = bigNumberMantissaSigned + smallNumberMantissaSigned;
+
+        // Convert the signed sum back into an unsigned number
+        two_sumSign <= sumMantissa[SUM_CALC_SIZE - 1];
+        if (sumMantissa[SUM_CALC_SIZE - 1])
+        begin
+            sumMantissa = ~sumMantissa + 1;
+        end
+        two_sumMantissa <= sumMantissa[0 +: SUM_SIZE];
+        two_sumExponent <= one_bigNumberExponent;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Normalize the sum to 1.0 .. 3.999..
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [LEADING_ONE_SIZE - 1 : 0] leadingOne;
+    FindExponent #(.EXPONENT_SIZE(LEADING_ONE_SIZE), .VALUE_SIZE(SUM_SIZE)) findExponent (two_sumMantissa, leadingOne);
+
+    always @(posedge clk)
+    if (ce) begin : Normalize
+        reg  signed [EXPONENT_CALC_SIZE - 1 : 0]    exponent;
+        reg  [LEADING_ONE_SIZE - 1 : 0]             shift;
+        reg  [SUM_SIZE - 1 : 0]                     mantissa;
+
+        exponent = $signed({ two_sumExponent[UNPACKED_EXPONENT_SIZE - 1], two_sumExponent });
+        mantissa = two_sumMantissa;
+
+        if (leadingOne == LEADING_ONE_INVALID_VALUE[0 +: LEADING_ONE_SIZE])
+        begin
+            // The sum is zero
+            exponent = UNPACKED_EXPONENT_MIN;
+        end
+        else if (leadingOne == (SUM_SIZE - 1))
+        begin
+            // The sum is bigger than 3.999..
+            mantissa = mantissa >> 1;
+            exponent = exponent + { { (EXPONENT_CALC_SIZE - 1) { 1'b0 } }, 1'b1 };
+        end
+        else if (leadingOne < (SUM_SIZE - 3))
+        begin
+            // The sum is smaller than 1.0
+            shift = (SUM_SIZE[0 +: LEADING_ONE_SIZE] - 3) - leadingOne;
+            mantissa = mantissa << shift;
+            exponent = exponent - { { (EXPONENT_CALC_SIZE - LEADING_ONE_SIZE) { 1'b0 } }, shift };
+        end
+
+        // Clamp the exponent, so that it can't wrap around in a long chain of operations
+        if (exponent < UNPACKED_EXPONENT_MIN)
+        begin
+            exponent = UNPACKED_EXPONENT_MIN;
+            mantissa = 0;
+        end
+        else if (exponent > UNPACKED_EXPONENT_MAX)
+        begin
+            exponent = UNPACKED_EXPONENT_MAX;
+        end
+
+        sum <= { two_sumSign, exponent[0 +: UNPACKED_EXPONENT_SIZE], mantissa[0 +: UNPACKED_MANTISSA_SIZE] };
+    end
+endmodule
@@ -0,0 +1,125 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Bilinear filter of four texels with CHANNELS channels (for instance RGBA)
+// top = lerp(texel00, texel10, x), bottom = lerp(texel01, texel11, x), out = lerp(top, bottom, y)
+// texelXY is the texel at the position (X, Y). The fractions x and y are unsigned fixed point numbers
+// with FRACTION_SIZE fraction bits (0.0 .. 0.999..). They are converted with an IntToFloat which is
+// shared by all channels, the texels are delayed with a ValueDelay until the fractions are converted.
+// The channels are concatenated, channel 0 is in the LSBs.
+// Resources per channel: Three FloatLerps, which are three FloatSubUnpacked, three FloatMulUnpacked
+// (each with one (MANTISSA_SIZE + GUARD_SIZE + 1) x (MANTISSA_SIZE + GUARD_SIZE + 1) multiplier),
+// three FloatAddUnpacked, three FloatPacks and nine FloatUnpacks (the unpacking of the fractions
+// is identical in all channels and can be merged by the synthesis). Additionally, the ValueDelays of
+// four texels (4 * FLOAT_SIZE bits for INT_TO_FLOAT_LATENCY clocks) and of the vertical fraction.
+// This module is pipelined. It can filter one pixel with all channels per clock
+// This module has a latency of 4 + (2 * (9 + MUL_DELAY)) clock cycles
+module FloatBilinear
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    parameter CHANNELS = 4,
+    parameter FRACTION_SIZE = 8,
+    parameter MUL_DELAY = 0, // DELAY of the FloatMulUnpacked
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam PIXEL_SIZE = CHANNELS * FLOAT_SIZE,
+    localparam LATENCY = `FLOAT_BILINEAR_LATENCY(MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [PIXEL_SIZE - 1 : 0]    texel00,
+    input  wire [PIXEL_SIZE - 1 : 0]    texel10,
+    input  wire [PIXEL_SIZE - 1 : 0]    texel01,
+    input  wire [PIXEL_SIZE - 1 : 0]    texel11,
+    input  wire [FRACTION_SIZE - 1 : 0] x,
+    input  wire [FRACTION_SIZE - 1 : 0] y,
+    output wire [PIXEL_SIZE - 1 : 0]    out
+);
+    localparam LERP_LATENCY = `FLOAT_LERP_LATENCY(MUL_DELAY);
+    localparam signed [EXPONENT_SIZE - 1 : 0] INT_TO_FLOAT_OFFSET = -FRACTION_SIZE;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Convert the fractions into floats
+    // Clocks: INT_TO_FLOAT_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]       xFloat;
+    wire [FLOAT_SIZE - 1 : 0]       yFloat;
+    wire [(4 * PIXEL_SIZE) - 1 : 0] texels;
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(FRACTION_SIZE + 1))
+        xToFloat (.clk(clk), .ce(ce), .offset(INT_TO_FLOAT_OFFSET), .in({ 1'b0, x }), .out(xFloat));
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(FRACTION_SIZE + 1))
+        yToFloat (.clk(clk), .ce(ce), .offset(INT_TO_FLOAT_OFFSET), .in({ 1'b0, y }), .out(yFloat));
+
+    ValueDelay #(.VALUE_SIZE(4 * PIXEL_SIZE), .DELAY(`INT_TO_FLOAT_LATENCY)) 
+        texelDelay (.clk(clk), .ce(ce), .in({ texel11, texel01, texel10, texel00 }), .out(texels));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Horizontal interpolation and vertical interpolation
+    // Clocks: 2 * FLOAT_LERP_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]       yDelayed;
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(LERP_LATENCY)) 
+        yDelay (.clk(clk), .ce(ce), .in(yFloat), .out(yDelayed));
+
+    generate
+        genvar c;
+        for (c = 0; c < CHANNELS; c = c + 1)
+        begin : Channel
+            wire [FLOAT_SIZE - 1 : 0] top;
+            wire [FLOAT_SIZE - 1 : 0] bottom;
+
+            FloatLerp #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE), .MUL_DELAY(MUL_DELAY))
+                topLerp (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .a(texels[(0 * PIXEL_SIZE) + (c * FLOAT_SIZE) +: FLOAT_SIZE]), 
+                    .b(texels[(1 * PIXEL_SIZE) + (c * FLOAT_SIZE) +: FLOAT_SIZE]), 
+                    .t(xFloat), 
+                    .out(top)
+                );
+
+            FloatLerp #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE), .MUL_DELAY(MUL_DELAY))
+                bottomLerp (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .a(texels[(2 * PIXEL_SIZE) + (c * FLOAT_SIZE) +: FLOAT_SIZE]), 
+                    .b(texels[(3 * PIXEL_SIZE) + (c * FLOAT_SIZE) +: FLOAT_SIZE]), 
+                    .t(xFloat), 
+                    .out(bottom)
+                );
+
+            FloatLerp #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE), .MUL_DELAY(MUL_DELAY))
+                verticalLerp (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .a(top), 
+                    .b(bottom), 
+                    .t(yDelayed), 
+                    .out(out[c * FLOAT_SIZE +: FLOAT_SIZE])
+                );
+        end
+    endgenerate
+endmodule
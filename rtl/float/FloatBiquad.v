@@ -0,0 +1,143 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Cascade of SECTIONS IIR biquads (direct form 1) which are shared by CHANNELS independent channels:
+// H(z) = (b0 + b1 * z^-1 + b2 * z^-2) / (1 + a1 * z^-1 + a2 * z^-2)
+// y[n] = (b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2]) - a1 * y[n - 1] - a2 * y[n - 2]
+// The feedback of y through a FloatMul and a FloatAdd3 requires LOOP_LATENCY clocks. A single channel
+// could therefore only be updated every LOOP_LATENCY clocks. To use the units in every clock, the
+// samples of the channels are interleaved: x contains the sample n of channel c in clock
+// (n * CHANNELS) + c. CHANNELS must be at least LOOP_LATENCY, otherwise the elaboration fails.
+// The state of the channels (x[n - 1], x[n - 2], y[n - 1], y[n - 2]) is stored in ValueDelays with
+// a length of CHANNELS, which are mapped into shift register LUTs or distributed RAM.
+// The sections are connected in series. Every section has its own units and processes all
+// channels, so the units of all sections are busy in every clock.
+// COEFFICIENTS contains 5 floats per section { a2, a1, b2, b1, b0 }, section 0 and b0 in the LSBs.
+// The default is a low pass with b = { 0.25, 0.5, 0.25 } and a = { -0.5, 0.25 }.
+// This module is pipelined. It can filter one sample per clock
+// This module has a latency of SECTIONS * (10 + MUL_DELAY) clock cycles
+module FloatBiquad
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter CHANNELS = 8,
+    parameter SECTIONS = 1,
+    parameter [(SECTIONS * 5 * (1 + EXPONENT_SIZE + MANTISSA_SIZE)) - 1 : 0] COEFFICIENTS = { 32'h3e800000, 32'hbf000000, 32'h3e800000, 32'h3f000000, 32'h3e800000 },
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LOOP_LATENCY = `FLOAT_BIQUAD_LOOP_LATENCY(MUL_DELAY),
+    localparam LATENCY = `FLOAT_BIQUAD_LATENCY(SECTIONS, MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    x,
+    output wire [FLOAT_SIZE - 1 : 0]    y
+);
+    generate
+        if (CHANNELS < LOOP_LATENCY)
+        begin : CheckChannels
+            // The state of a channel would be read before it is calculated.
+            // This module doesn't exist, so that the elaboration fails.
+            FloatBiquad_requires_CHANNELS_of_at_least_LOOP_LATENCY error ();
+        end
+    endgenerate
+
+    // Input of the sections, the last entry is the output of the cascade
+    wire [((SECTIONS + 1) * FLOAT_SIZE) - 1 : 0] xs;
+
+    assign xs[0 +: FLOAT_SIZE] = x;
+
+    generate
+        genvar s;
+        for (s = 0; s < SECTIONS; s = s + 1)
+        begin : Section
+            localparam [FLOAT_SIZE - 1 : 0] B0 = COEFFICIENTS[((s * 5) + 0) * FLOAT_SIZE +: FLOAT_SIZE];
+            localparam [FLOAT_SIZE - 1 : 0] B1 = COEFFICIENTS[((s * 5) + 1) * FLOAT_SIZE +: FLOAT_SIZE];
+            localparam [FLOAT_SIZE - 1 : 0] B2 = COEFFICIENTS[((s * 5) + 2) * FLOAT_SIZE +: FLOAT_SIZE];
+            localparam [FLOAT_SIZE - 1 : 0] A1 = COEFFICIENTS[((s * 5) + 3) * FLOAT_SIZE +: FLOAT_SIZE];
+            localparam [FLOAT_SIZE - 1 : 0] A2 = COEFFICIENTS[((s * 5) + 4) * FLOAT_SIZE +: FLOAT_SIZE];
+            // The feedback is added, so the signs of a1 and a2 are flipped
+            localparam [FLOAT_SIZE - 1 : 0] A1_NEG = { ~A1[FLOAT_SIZE - 1], A1[0 +: FLOAT_SIZE - 1] };
+            localparam [FLOAT_SIZE - 1 : 0] A2_NEG = { ~A2[FLOAT_SIZE - 1], A2[0 +: FLOAT_SIZE - 1] };
+
+            ////////////////////////////////////////////////////////////////////////////
+            // STEP 0
+            // Feedforward: b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2]
+            // Clocks: FLOAT_MUL_LATENCY + FLOAT_ADD3_LATENCY
+            ////////////////////////////////////////////////////////////////////////////
+            wire [FLOAT_SIZE - 1 : 0]   x1;
+            wire [FLOAT_SIZE - 1 : 0]   x2;
+            wire [FLOAT_SIZE - 1 : 0]   b0x;
+            wire [FLOAT_SIZE - 1 : 0]   b1x;
+            wire [FLOAT_SIZE - 1 : 0]   b2x;
+            wire [FLOAT_SIZE - 1 : 0]   feedforward;
+
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(CHANNELS)) 
+                x1Delay (.clk(clk), .ce(ce), .in(xs[s * FLOAT_SIZE +: FLOAT_SIZE]), .out(x1));
+
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(CHANNELS)) 
+                x2Delay (.clk(clk), .ce(ce), .in(x1), .out(x2));
+
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                b0Mul (.clk(clk), .ce(ce), .facAIn(xs[s * FLOAT_SIZE +: FLOAT_SIZE]), .facBIn(B0), .prod(b0x));
+
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                b1Mul (.clk(clk), .ce(ce), .facAIn(x1), .facBIn(B1), .prod(b1x));
+
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                b2Mul (.clk(clk), .ce(ce), .facAIn(x2), .facBIn(B2), .prod(b2x));
+
+            FloatAdd3 #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                feedforwardAdd (.clk(clk), .ce(ce), .aIn(b0x), .bIn(b1x), .cIn(b2x), .sum(feedforward));
+
+            ////////////////////////////////////////////////////////////////////////////
+            // STEP 1
+            // Feedback: y[n] = feedforward - a1 * y[n - 1] - a2 * y[n - 2]
+            // y[n - 1] of a channel is the result of the previous turn of the channels. It is
+            // delayed, so that its product is ready when the next sample of the channel is added.
+            // Clocks: FLOAT_ADD3_LATENCY
+            ////////////////////////////////////////////////////////////////////////////
+            wire [FLOAT_SIZE - 1 : 0]   y0;
+            wire [FLOAT_SIZE - 1 : 0]   y1;
+            wire [FLOAT_SIZE - 1 : 0]   y2;
+            wire [FLOAT_SIZE - 1 : 0]   a1y;
+            wire [FLOAT_SIZE - 1 : 0]   a2y;
+
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(CHANNELS - LOOP_LATENCY)) 
+                y1Delay (.clk(clk), .ce(ce), .in(y0), .out(y1));
+
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(CHANNELS)) 
+                y2Delay (.clk(clk), .ce(ce), .in(y1), .out(y2));
+
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                a1Mul (.clk(clk), .ce(ce), .facAIn(y1), .facBIn(A1_NEG), .prod(a1y));
+
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                a2Mul (.clk(clk), .ce(ce), .facAIn(y2), .facBIn(A2_NEG), .prod(a2y));
+
+            FloatAdd3 #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                feedbackAdd (.clk(clk), .ce(ce), .aIn(feedforward), .bIn(a1y), .cIn(a2y), .sum(y0));
+
+            assign xs[(s + 1) * FLOAT_SIZE +: FLOAT_SIZE] = y0;
+        end
+    endgenerate
+
+    assign y = xs[SECTIONS * FLOAT_SIZE +: FLOAT_SIZE];
+endmodule
@@ -0,0 +1,230 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Runs a float operation in a second (faster) clock domain.
+// The operands are transferred from the bus domain (busClk) into the calculation
+// domain (calcClk) via a ValueAsyncFifo. The results are transferred back via a
+// second ValueAsyncFifo. Because calcClk is usually faster than busClk, one
+// arithmetic unit can serve several bus ports (PORTS). The ports are served
+// round robin. Each port has its own pair of FIFOs and uses a valid/ready handshake.
+// The arithmetic unit itself can't be stalled. A value is only issued into the
+// unit, when the result FIFO of the port has a free entry for it. Therefore
+// 'outReady' can be deasserted at any time without losing results.
+// OPERATION selects the unit: "MUL" (FloatMul), "ADD" (FloatAdd) or "SUB" (FloatSub).
+// The aIn, bIn and out ports of all PORTS are concatenated. Port 0 uses the LSBs.
+// This module is pipelined. It can calculate one operation per calcClk
+// This module has a latency of LATENCY calcClk cycles plus the synchronization of
+// both FIFOs (roughly 3 calcClk and 3 busClk cycles)
+module FloatCdc
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter OPERATION = "MUL",
+    parameter PORTS = 1,
+    parameter FIFO_ADDR_SIZE = 4, // Depth of the FIFOs is 2 ** FIFO_ADDR_SIZE
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul. Use it to retime the multiplier for a faster calcClk
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam UNIT_LATENCY = (OPERATION == "MUL") ? `FLOAT_MUL_LATENCY(MUL_DELAY) : `FLOAT_ADD_LATENCY,
+    localparam LATENCY = 1 + UNIT_LATENCY // Issue register plus unit, measured in calcClk cycles
+)
+(
+    // Bus domain
+    input  wire                                 busClk,
+    input  wire                                 busResetn,
+
+    input  wire [PORTS - 1 : 0]                 inValid,
+    output wire [PORTS - 1 : 0]                 inReady,
+    input  wire [(PORTS * FLOAT_SIZE) - 1 : 0]  aIn,
+    input  wire [(PORTS * FLOAT_SIZE) - 1 : 0]  bIn,
+
+    output wire [PORTS - 1 : 0]                 outValid,
+    input  wire [PORTS - 1 : 0]                 outReady,
+    output wire [(PORTS * FLOAT_SIZE) - 1 : 0]  out,
+
+    // Calculation domain
+    // calcResetn must be asserted for at least LATENCY cycles to flush the arithmetic unit
+    input  wire                                 calcClk,
+    input  wire                                 calcResetn
+);
+    localparam FIFO_DEPTH = 2 ** FIFO_ADDR_SIZE;
+    localparam FIFO_PTR_SIZE = FIFO_ADDR_SIZE + 1;
+    localparam PORT_SIZE = (PORTS > 1) ? $clog2(PORTS) : 1;
+
+    wire [PORTS - 1 : 0]                    opValid;
+    reg  [PORTS - 1 : 0]                    opReady;
+    wire [(PORTS * 2 * FLOAT_SIZE) - 1 : 0] opData;
+
+    wire [(PORTS * FIFO_PTR_SIZE) - 1 : 0]  resultFill;
+    reg  [PORTS - 1 : 0]                    resultWrite;
+
+    wire [FLOAT_SIZE - 1 : 0]               result;
+    wire                                    resultValid;
+    wire [PORT_SIZE - 1 : 0]                resultPort;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // FIFOs between both clock domains
+    ////////////////////////////////////////////////////////////////////////////
+    generate
+        genvar p;
+        for (p = 0; p < PORTS; p = p + 1)
+        begin : Port
+            ValueAsyncFifo #(.VALUE_SIZE(2 * FLOAT_SIZE), .ADDR_SIZE(FIFO_ADDR_SIZE))
+                operandFifo (
+                    .wrClk(busClk),
+                    .wrResetn(busResetn),
+                    .inValid(inValid[p]),
+                    .inReady(inReady[p]),
+                    .in({ bIn[p * FLOAT_SIZE +: FLOAT_SIZE], aIn[p * FLOAT_SIZE +: FLOAT_SIZE] }),
+                    .wrFill(),
+
+                    .rdClk(calcClk),
+                    .rdResetn(calcResetn),
+                    .outValid(opValid[p]),
+                    .outReady(opReady[p]),
+                    .out(opData[p * 2 * FLOAT_SIZE +: 2 * FLOAT_SIZE])
+                );
+
+            ValueAsyncFifo #(.VALUE_SIZE(FLOAT_SIZE), .ADDR_SIZE(FIFO_ADDR_SIZE))
+                resultFifo (
+                    .wrClk(calcClk),
+                    .wrResetn(calcResetn),
+                    .inValid(resultWrite[p]),
+                    .inReady(), // Can't be full, the entry is reserved before the value is issued
+                    .in(result),
+                    .wrFill(resultFill[p * FIFO_PTR_SIZE +: FIFO_PTR_SIZE]),
+
+                    .rdClk(busClk),
+                    .rdResetn(busResetn),
+                    .outValid(outValid[p]),
+                    .outReady(outReady[p]),
+                    .out(out[p * FLOAT_SIZE +: FLOAT_SIZE])
+                );
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Arbitration (calculation domain)
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [PORT_SIZE - 1 : 0]                nextPort = 0; // Port with the highest priority
+    reg  [(PORTS * FIFO_PTR_SIZE) - 1 : 0]  inFlight = 0; // Issued values which are not yet in the result FIFO
+    reg                                     issue;
+    reg  [PORT_SIZE - 1 : 0]                issuePort;
+
+    always @(*)
+    begin : Arbiter
+        integer i;
+        reg [PORT_SIZE : 0] port;
+        reg [FIFO_PTR_SIZE : 0] reserved;
+
+        issue = 0;
+        issuePort = 0;
+        opReady = 0;
+        for (i = PORTS - 1; i >= 0; i = i - 1)
+        begin
+            // Iterate backwards, so that the port which is the closest to nextPort wins
+            port = { 1'b0, nextPort } + i[0 +: PORT_SIZE + 1];
+            if (port >= PORTS[0 +: PORT_SIZE + 1])
+            begin
+                port = port - PORTS[0 +: PORT_SIZE + 1];
+            end
+
+            // Reserve an entry in the result FIFO for every value in the pipeline
+            reserved = { 1'b0, resultFill[port[0 +: PORT_SIZE] * FIFO_PTR_SIZE +: FIFO_PTR_SIZE] }
+                + { 1'b0, inFlight[port[0 +: PORT_SIZE] * FIFO_PTR_SIZE +: FIFO_PTR_SIZE] };
+            if (opValid[port[0 +: PORT_SIZE]] && (reserved < FIFO_DEPTH[0 +: FIFO_PTR_SIZE + 1]))
+            begin
+                issue = 1;
+                issuePort = port[0 +: PORT_SIZE];
+            end
+        end
+        opReady[issuePort] = issue;
+    end
+
+    always @(posedge calcClk)
+    begin
+        if (!calcResetn)
+        begin
+            nextPort <= 0;
+            inFlight <= 0;
+        end
+        else
+        begin : Bookkeeping
+            integer i;
+
+            if (issue)
+            begin
+                nextPort <= (issuePort == (PORTS - 1)) ? 0 : issuePort + 1;
+            end
+
+            for (i = 0; i < PORTS; i = i + 1)
+            begin
+                if (issue && (issuePort == i) && !resultWrite[i])
+                begin
+                    inFlight[i * FIFO_PTR_SIZE +: FIFO_PTR_SIZE] <= inFlight[i * FIFO_PTR_SIZE +: FIFO_PTR_SIZE] + 1;
+                end
+                if (!(issue && (issuePort == i)) && resultWrite[i])
+                begin
+                    inFlight[i * FIFO_PTR_SIZE +: FIFO_PTR_SIZE] <= inFlight[i * FIFO_PTR_SIZE +: FIFO_PTR_SIZE] - 1;
+                end
+            end
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Arithmetic unit (calculation domain)
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [FLOAT_SIZE - 1 : 0]   one_a = 0;
+    reg  [FLOAT_SIZE - 1 : 0]   one_b = 0;
+    reg                         one_valid = 0;
+    reg  [PORT_SIZE - 1 : 0]    one_port = 0;
+    always @(posedge calcClk)
+    begin
+        one_a <= opData[issuePort * 2 * FLOAT_SIZE +: FLOAT_SIZE];
+        one_b <= opData[(issuePort * 2 * FLOAT_SIZE) + FLOAT_SIZE +: FLOAT_SIZE];
+        one_port <= issuePort;
+        one_valid <= issue && calcResetn;
+    end
+
+    generate
+        if (OPERATION == "MUL")
+        begin
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                unit (.clk(calcClk), .ce(1'b1), .facAIn(one_a), .facBIn(one_b), .prod(result));
+        end
+        else if (OPERATION == "ADD")
+        begin
+            FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                unit (.clk(calcClk), .ce(1'b1), .aIn(one_a), .bIn(one_b), .sum(result));
+        end
+        else
+        begin
+            FloatSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                unit (.clk(calcClk), .ce(1'b1), .aIn(one_a), .bIn(one_b), .sum(result));
+        end
+    endgenerate
+
+    ValueDelay #(.VALUE_SIZE(1 + PORT_SIZE), .DELAY(UNIT_LATENCY))
+        tagDelay (.clk(calcClk), .ce(1'b1), .in({ one_valid, one_port }), .out({ resultValid, resultPort }));
+
+    always @(*)
+    begin
+        resultWrite = 0;
+        resultWrite[resultPort] = resultValid;
+    end
+endmodule
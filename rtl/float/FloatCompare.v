@@ -0,0 +1,112 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point compare, min, max and clamp
+// Compares aIn with bIn and outputs the flags lt (a < b), eq (a == b) and gt (a > b).
+// Additionally out is selected via mode:
+//  - MODE_MIN (0):   min(a, b)
+//  - MODE_MAX (1):   max(a, b)
+//  - MODE_CLAMP (2): clamp(a, b, c) which is min(max(a, b), c). b is the lower and c the upper
+//                    bound. b must not be bigger than c.
+// The numbers are mapped to integer keys which have the same order than the floats.
+// Then all compares are simple integer compares and can be calculated in parallel.
+// +0 and -0 are equal. NaNs are not handled, they are ordered like numbers which are
+// bigger than Inf (or smaller than -Inf when the sign is set).
+// This module is pipelined. It can calculate one compare per clock
+// This module has a latency of 1 clock cycle
+module FloatCompare
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_COMPARE_LATENCY
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [1 : 0]              mode,
+    input  wire [FLOAT_SIZE - 1 : 0] aIn,
+    input  wire [FLOAT_SIZE - 1 : 0] bIn,
+    input  wire [FLOAT_SIZE - 1 : 0] cIn,
+    output reg                       lt,
+    output reg                       eq,
+    output reg                       gt,
+    output reg  [FLOAT_SIZE - 1 : 0] out
+);
+    localparam [1 : 0] MODE_MIN = 0;
+    localparam [1 : 0] MODE_MAX = 1;
+    localparam [1 : 0] MODE_CLAMP = 2;
+
+    localparam SIGN_POS = FLOAT_SIZE - 1;
+
+    // Maps a float to an unsigned integer with the same order.
+    // Positive numbers are moved above the negative numbers by setting the sign bit.
+    // The magnitude of negative numbers is inverted, so that a bigger magnitude
+    // results in a smaller key. -0 is mapped to +0.
+    function [FLOAT_SIZE - 1 : 0] orderKey;
+        input [FLOAT_SIZE - 1 : 0] value;
+        begin
+            if (value[SIGN_POS] && (value[0 +: SIGN_POS] != 0))
+            begin
+                orderKey = { 1'b0, ~value[0 +: SIGN_POS] };
+            end
+            else
+            begin
+                orderKey = { 1'b1, value[0 +: SIGN_POS] };
+            end
+        end
+    endfunction
+
+    wire [FLOAT_SIZE - 1 : 0] aKey = orderKey(aIn);
+    wire [FLOAT_SIZE - 1 : 0] bKey = orderKey(bIn);
+    wire [FLOAT_SIZE - 1 : 0] cKey = orderKey(cIn);
+
+    always @(posedge clk)
+    if (ce) begin : Compare
+        reg aLessB;
+        reg aGreaterC;
+
+        aLessB = aKey < bKey;
+        aGreaterC = aKey > cKey;
+
+        lt <= aLessB;
+        eq <= aKey == bKey;
+        gt <= aKey > bKey;
+
+        case (mode)
+            MODE_MIN:
+                out <= (aLessB) ? aIn : bIn;
+            MODE_MAX:
+                out <= (aKey > bKey) ? aIn : bIn;
+            default: // MODE_CLAMP
+                if (aLessB)
+                begin
+                    out <= bIn;
+                end
+                else if (aGreaterC)
+                begin
+                    out <= cIn;
+                end
+                else
+                begin
+                    out <= aIn;
+                end
+        endcase
+    end
+endmodule
@@ -0,0 +1,105 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Complex multiplication (aRe + i * aIm) * (bRe + i * bIm) with three real multiplications (Gauss):
+// k1 = bRe * (aRe + aIm)
+// k2 = aRe * (bIm - bRe)
+// k3 = aIm * (bRe + bIm)
+// re = k1 - k3
+// im = k1 + k2
+// It requires three mantissa multipliers (DSPs) instead of four, but five instead of two
+// additions. bIm + bRe and bIm - bRe are calculated with a FloatAddSub (shared alignment).
+// The operands which bypass the additions are delayed with ValueDelays.
+// Because of the cancellation in the last step, the error is relative to
+// (|aRe| + |aIm|) * (|bRe| + |bIm|) and not to the magnitude of the result.
+// This module is pipelined. It can calculate one complex multiplication per clock
+// This module has a latency of 10 + MUL_DELAY clock cycles
+module FloatComplexMul
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_COMPLEX_MUL_LATENCY(MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    aRe,
+    input  wire [FLOAT_SIZE - 1 : 0]    aIm,
+    input  wire [FLOAT_SIZE - 1 : 0]    bRe,
+    input  wire [FLOAT_SIZE - 1 : 0]    bIm,
+    output wire [FLOAT_SIZE - 1 : 0]    re,
+    output wire [FLOAT_SIZE - 1 : 0]    im
+);
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Pre-additions
+    // Clocks: FLOAT_ADD_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]   aSum;
+    wire [FLOAT_SIZE - 1 : 0]   bSum;
+    wire [FLOAT_SIZE - 1 : 0]   bDiff;
+    wire [FLOAT_SIZE - 1 : 0]   aReDelayed;
+    wire [FLOAT_SIZE - 1 : 0]   aImDelayed;
+    wire [FLOAT_SIZE - 1 : 0]   bReDelayed;
+
+    FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        aAdd (.clk(clk), .ce(ce), .aIn(aRe), .bIn(aIm), .sum(aSum));
+
+    FloatAddSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        bAddSub (.clk(clk), .ce(ce), .aIn(bIm), .bIn(bRe), .sum(bSum), .diff(bDiff));
+
+    ValueDelay #(.VALUE_SIZE(3 * FLOAT_SIZE), .DELAY(`FLOAT_ADD_LATENCY)) 
+        operandDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ aRe, aIm, bRe }), 
+            .out({ aReDelayed, aImDelayed, bReDelayed })
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Multiplications
+    // Clocks: FLOAT_MUL_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]   k1;
+    wire [FLOAT_SIZE - 1 : 0]   k2;
+    wire [FLOAT_SIZE - 1 : 0]   k3;
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+        k1Mul (.clk(clk), .ce(ce), .facAIn(bReDelayed), .facBIn(aSum), .prod(k1));
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+        k2Mul (.clk(clk), .ce(ce), .facAIn(aReDelayed), .facBIn(bDiff), .prod(k2));
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+        k3Mul (.clk(clk), .ce(ce), .facAIn(aImDelayed), .facBIn(bSum), .prod(k3));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Post-additions
+    // Clocks: FLOAT_ADD_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    FloatSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        reSub (.clk(clk), .ce(ce), .aIn(k1), .bIn(k3), .sum(re));
+
+    FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        imAdd (.clk(clk), .ce(ce), .aIn(k1), .bIn(k2), .sum(im));
+endmodule
@@ -0,0 +1,435 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point CORDIC
+// MODE selects the function:
+//  - "VECTORING": xOut = sqrt(xIn * xIn + yIn * yIn), angleOut = atan2(yIn, xIn)
+//  - "ROTATION": Rotates (xIn, yIn) by angleIn (radians, -pi .. pi):
+//      xOut = xIn * cos(angleIn) - yIn * sin(angleIn)
+//      yOut = xIn * sin(angleIn) + yIn * cos(angleIn)
+//    With xIn = 1.0 and yIn = 0.0, xOut is cos(angleIn) and yOut is sin(angleIn).
+// The outputs which are not used by a mode are zero.
+// xIn and yIn are scaled with their common exponent and converted with FloatToInt into fixed
+// point numbers with MANTISSA_SIZE + GUARD_SIZE fraction bits. Every iteration uses one stage
+// with shifts and additions. The gain of the CORDIC is compensated with shifts and additions.
+// The results are converted with IntToFloat and scaled back. No multipliers are used.
+// Every iteration adds roughly one bit of accuracy to the angle. The error of xOut and yOut
+// is an absolute error relative to the bigger input. Measured for a float (s=1, e=8, m=23)
+// with ITERATIONS = 25: atan2 < 2 ** -21, sqrt(x * x + y * y) < 1 ulp, sin and cos < 2 ** -22.
+// Denormalized numbers are handled like zero. NaN and Inf result in NaN, only 
+// sqrt(x * x + y * y) with an Inf is Inf.
+// This module is pipelined. It can calculate one vectoring or rotation per clock
+// This module has a latency of ITERATIONS + 10 clock cycles
+module FloatCordic
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter MODE = "VECTORING",
+    parameter ITERATIONS = MANTISSA_SIZE + 2,
+    parameter GUARD_SIZE = 6,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_CORDIC_LATENCY(ITERATIONS)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    xIn,
+    input  wire [FLOAT_SIZE - 1 : 0]    yIn,
+    input  wire [FLOAT_SIZE - 1 : 0]    angleIn,
+    output reg  [FLOAT_SIZE - 1 : 0]    xOut,
+    output reg  [FLOAT_SIZE - 1 : 0]    yOut,
+    output reg  [FLOAT_SIZE - 1 : 0]    angleOut
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam EXPONENT_MAX = (2 ** EXPONENT_SIZE) - 1; // Inf and NaN
+    localparam EXPONENT_CALC_SIZE = EXPONENT_SIZE + 2;
+
+    localparam FRACTION_SIZE = MANTISSA_SIZE + GUARD_SIZE;
+    // The vector grows with sqrt(2) and the gain of the CORDIC (1.65). The angle is in the range of -3 / 2 * pi .. 3 / 2 * pi.
+    localparam VALUE_SIZE = FRACTION_SIZE + 4;
+    localparam signed [EXPONENT_SIZE - 1 : 0] CONVERSION_OFFSET = -FRACTION_SIZE;
+    localparam VECTORING = MODE == "VECTORING";
+    localparam real PI = 3.141592653589793;
+
+    // Rounds a real number to the fixed point format
+    function [VALUE_SIZE - 1 : 0] realToFixed;
+        input real value;
+        real magnitude;
+        integer i;
+        begin
+            magnitude = (value < 0.0) ? -value : value;
+            magnitude = $floor((magnitude * (2.0 ** FRACTION_SIZE)) + 0.5);
+            for (i = VALUE_SIZE - 1; i >= 0; i = i - 1)
+            begin
+                realToFixed[i] = magnitude >= (2.0 ** i);
+                if (realToFixed[i])
+                begin
+                    magnitude = magnitude - (2.0 ** i);
+                end
+            end
+            if (value < 0.0)
+            begin
+                realToFixed = ~realToFixed + 1;
+            end
+        end
+    endfunction
+
+    // Inverse of the gain of the CORDIC: 1 / prod(sqrt(1 + 2 ** (-2 * i)))
+    function real inverseGain;
+        input integer iterations;
+        integer i;
+        begin
+            inverseGain = 1.0;
+            for (i = 0; i < iterations; i = i + 1)
+            begin
+                inverseGain = inverseGain / $sqrt(1.0 + (2.0 ** (-2 * i)));
+            end
+        end
+    endfunction
+
+    // Canonical signed digits of the inverse gain. A set bit i in the positive (negative) digits
+    // adds (subtracts) value * 2 ** (i - FRACTION_SIZE). It needs roughly a third of the additions
+    // of the plain binary representation.
+    function [FRACTION_SIZE : 0] gainDigits;
+        input negative;
+        reg [FRACTION_SIZE + 1 : 0] value;
+        integer i;
+        begin
+            value = { 1'b0, INVERSE_GAIN[0 +: FRACTION_SIZE + 1] };
+            gainDigits = 0;
+            for (i = 0; i <= FRACTION_SIZE; i = i + 1)
+            begin
+                if (value[i])
+                begin
+                    // A sequence of ones (011..1) is replaced by (100..-1)
+                    gainDigits[i] = value[i + 1] ? negative : !negative;
+                    if (value[i + 1])
+                    begin
+                        value = value + ({ { (FRACTION_SIZE + 1) { 1'b0 } }, 1'b1 } << i);
+                    end
+                end
+            end
+        end
+    endfunction
+
+    localparam [VALUE_SIZE - 1 : 0] INVERSE_GAIN = realToFixed(inverseGain(ITERATIONS));
+    localparam [FRACTION_SIZE : 0] GAIN_POSITIVE_DIGITS = gainDigits(0);
+    localparam [FRACTION_SIZE : 0] GAIN_NEGATIVE_DIGITS = gainDigits(1);
+    localparam [VALUE_SIZE - 1 : 0] PI_FIXED = realToFixed(PI);
+    localparam [VALUE_SIZE - 1 : 0] PI_HALF_FIXED = realToFixed(PI / 2.0);
+
+    function [VALUE_SIZE - 1 : 0] compensateGain;
+        input [VALUE_SIZE - 1 : 0] value;
+        reg signed [VALUE_SIZE - 1 : 0] sum;
+        integer i;
+        begin
+            sum = 0;
+            for (i = 0; i <= FRACTION_SIZE; i = i + 1)
+            begin
+                if (GAIN_POSITIVE_DIGITS[i])
+                begin
+                    sum = sum + ($signed(value) >>> (FRACTION_SIZE - i));
+                end
+                if (GAIN_NEGATIVE_DIGITS[i])
+                begin
+                    sum = sum - ($signed(value) >>> (FRACTION_SIZE - i));
+                end
+            end
+            compensateGain = sum;
+        end
+    endfunction
+
+    // Adds the exponent which was removed before the conversion
+    function [FLOAT_SIZE - 1 : 0] rescale;
+        input [FLOAT_SIZE - 1 : 0]      value;
+        input [EXPONENT_SIZE - 1 : 0]   exponent;
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] e;
+        begin
+            e = $signed({ 2'b0, value[EXPONENT_POS +: EXPONENT_SIZE] }) 
+                + $signed({ 2'b0, exponent }) 
+                - EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE];
+            if ((value[EXPONENT_POS +: EXPONENT_SIZE] == 0) || (e <= 0))
+            begin
+                rescale = { value[SIGN_POS], { (FLOAT_SIZE - 1) { 1'b0 } } };
+            end
+            else if (e >= EXPONENT_MAX)
+            begin
+                rescale = { value[SIGN_POS], EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b0 } } };
+            end
+            else
+            begin
+                rescale = { value[SIGN_POS], e[0 +: EXPONENT_SIZE], value[MANTISSA_POS +: MANTISSA_SIZE] };
+            end
+        end
+    endfunction
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Scale x and y with the exponent of the bigger number, so that the 
+    // bigger number is in the range of 1.0 .. 2.0
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [EXPONENT_SIZE - 1 : 0] exponentMax = (xIn[EXPONENT_POS +: EXPONENT_SIZE] > yIn[EXPONENT_POS +: EXPONENT_SIZE]) 
+        ? xIn[EXPONENT_POS +: EXPONENT_SIZE] 
+        : yIn[EXPONENT_POS +: EXPONENT_SIZE];
+    wire xNan = (xIn[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]) && (xIn[MANTISSA_POS +: MANTISSA_SIZE] != 0);
+    wire yNan = (yIn[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]) && (yIn[MANTISSA_POS +: MANTISSA_SIZE] != 0);
+    wire angleSpecial = !VECTORING && (angleIn[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]);
+
+    reg  [FLOAT_SIZE - 1 : 0]   one_x;
+    reg  [FLOAT_SIZE - 1 : 0]   one_y;
+    reg  [FLOAT_SIZE - 1 : 0]   one_angle;
+    reg                         one_xZero;
+    reg                         one_yZero;
+    reg                         one_angleZero;
+    always @(posedge clk)
+    if (ce) begin : Prescale
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] xExponent;
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] yExponent;
+
+        xExponent = $signed({ 2'b0, xIn[EXPONENT_POS +: EXPONENT_SIZE] }) 
+            - $signed({ 2'b0, exponentMax }) 
+            + EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE];
+        yExponent = $signed({ 2'b0, yIn[EXPONENT_POS +: EXPONENT_SIZE] }) 
+            - $signed({ 2'b0, exponentMax }) 
+            + EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE];
+
+        one_x <= { xIn[SIGN_POS], xExponent[0 +: EXPONENT_SIZE], xIn[MANTISSA_POS +: MANTISSA_SIZE] };
+        one_y <= { yIn[SIGN_POS], yExponent[0 +: EXPONENT_SIZE], yIn[MANTISSA_POS +: MANTISSA_SIZE] };
+        one_angle <= angleIn;
+        one_xZero <= (xIn[EXPONENT_POS +: EXPONENT_SIZE] == 0) || (xExponent <= 0);
+        one_yZero <= (yIn[EXPONENT_POS +: EXPONENT_SIZE] == 0) || (yExponent <= 0);
+        one_angleZero <= VECTORING || (angleIn[EXPONENT_POS +: EXPONENT_SIZE] == 0);
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Convert to fixed point
+    // Clocks: FLOAT_TO_INT_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [VALUE_SIZE - 1 : 0]   xFixed;
+    wire [VALUE_SIZE - 1 : 0]   yFixed;
+    wire [VALUE_SIZE - 1 : 0]   angleFixed;
+    wire                        xZeroDelayed;
+    wire                        yZeroDelayed;
+    wire                        angleZeroDelayed;
+
+    FloatToInt #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE), .DELAY(0))
+        xToFixed (.clk(clk), .ce(ce), .offset(CONVERSION_OFFSET), .in(one_x), .out(xFixed));
+
+    FloatToInt #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE), .DELAY(0))
+        yToFixed (.clk(clk), .ce(ce), .offset(CONVERSION_OFFSET), .in(one_y), .out(yFixed));
+
+    FloatToInt #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE), .DELAY(0))
+        angleToFixed (.clk(clk), .ce(ce), .offset(CONVERSION_OFFSET), .in(one_angle), .out(angleFixed));
+
+    ValueDelay #(.VALUE_SIZE(3), .DELAY(`FLOAT_TO_INT_LATENCY(0))) 
+        zeroDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ one_xZero, one_yZero, one_angleZero }), 
+            .out({ xZeroDelayed, yZeroDelayed, angleZeroDelayed })
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Rotate by pi, so that the iterations converge
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [VALUE_SIZE - 1 : 0]   two_x;
+    reg  [VALUE_SIZE - 1 : 0]   two_y;
+    reg  [VALUE_SIZE - 1 : 0]   two_z;
+    always @(posedge clk)
+    if (ce) begin : Prerotate
+        reg signed [VALUE_SIZE - 1 : 0] x;
+        reg signed [VALUE_SIZE - 1 : 0] y;
+        reg signed [VALUE_SIZE - 1 : 0] z;
+        reg                             rotate;
+
+        x = (xZeroDelayed) ? 0 : xFixed;
+        y = (yZeroDelayed) ? 0 : yFixed;
+        z = (angleZeroDelayed) ? 0 : angleFixed;
+        if (VECTORING)
+        begin
+            // atan2 of a vector in the left half plane
+            rotate = x < 0;
+            if (rotate)
+            begin
+                z = (y >= 0) ? PI_FIXED : -PI_FIXED;
+            end
+        end
+        else
+        begin
+            rotate = (z > $signed(PI_HALF_FIXED)) || (z < -$signed(PI_HALF_FIXED));
+            if (rotate)
+            begin
+                z = (z >= 0) ? z - PI_FIXED : z + PI_FIXED;
+            end
+        end
+
+        two_x <= (rotate) ? -x : x;
+        two_y <= (rotate) ? -y : y;
+        two_z <= z;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Iterations
+    // Clocks: ITERATIONS
+    ////////////////////////////////////////////////////////////////////////////
+    wire [((ITERATIONS + 1) * VALUE_SIZE) - 1 : 0] xs;
+    wire [((ITERATIONS + 1) * VALUE_SIZE) - 1 : 0] ys;
+    wire [((ITERATIONS + 1) * VALUE_SIZE) - 1 : 0] zs;
+
+    assign xs[0 +: VALUE_SIZE] = two_x;
+    assign ys[0 +: VALUE_SIZE] = two_y;
+    assign zs[0 +: VALUE_SIZE] = two_z;
+
+    generate
+        genvar k;
+        for (k = 0; k < ITERATIONS; k = k + 1)
+        begin : Iteration
+            localparam [VALUE_SIZE - 1 : 0] ANGLE = realToFixed($atan(2.0 ** (-k)));
+
+            reg  [VALUE_SIZE - 1 : 0] x;
+            reg  [VALUE_SIZE - 1 : 0] y;
+            reg  [VALUE_SIZE - 1 : 0] z;
+            always @(posedge clk)
+            if (ce) begin : Step
+                reg signed [VALUE_SIZE - 1 : 0] xCurrent;
+                reg signed [VALUE_SIZE - 1 : 0] yCurrent;
+                reg signed [VALUE_SIZE - 1 : 0] zCurrent;
+                reg                             counterclockwise;
+
+                xCurrent = xs[k * VALUE_SIZE +: VALUE_SIZE];
+                yCurrent = ys[k * VALUE_SIZE +: VALUE_SIZE];
+                zCurrent = zs[k * VALUE_SIZE +: VALUE_SIZE];
+                // Vectoring rotates y towards zero, rotation rotates z towards zero
+                counterclockwise = (VECTORING) ? yCurrent < 0 : zCurrent >= 0;
+                if (counterclockwise)
+                begin
+                    x <= xCurrent - (yCurrent >>> k);
+                    y <= yCurrent + (xCurrent >>> k);
+                    z <= zCurrent - ANGLE;
+                end
+                else
+                begin
+                    x <= xCurrent + (yCurrent >>> k);
+                    y <= yCurrent - (xCurrent >>> k);
+                    z <= zCurrent + ANGLE;
+                end
+            end
+            assign xs[(k + 1) * VALUE_SIZE +: VALUE_SIZE] = x;
+            assign ys[(k + 1) * VALUE_SIZE +: VALUE_SIZE] = y;
+            assign zs[(k + 1) * VALUE_SIZE +: VALUE_SIZE] = z;
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 4
+    // Compensate the gain
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [VALUE_SIZE - 1 : 0]   three_x;
+    reg  [VALUE_SIZE - 1 : 0]   three_y;
+    reg  [VALUE_SIZE - 1 : 0]   three_z;
+    always @(posedge clk)
+    if (ce) begin
+        three_x <= compensateGain(xs[ITERATIONS * VALUE_SIZE +: VALUE_SIZE]);
+        three_y <= compensateGain(ys[ITERATIONS * VALUE_SIZE +: VALUE_SIZE]);
+        three_z <= zs[ITERATIONS * VALUE_SIZE +: VALUE_SIZE];
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 5
+    // Convert into floats
+    // Clocks: INT_TO_FLOAT_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]   xFloat;
+    wire [FLOAT_SIZE - 1 : 0]   yFloat;
+    wire [FLOAT_SIZE - 1 : 0]   angleFloat;
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE))
+        xToFloat (.clk(clk), .ce(ce), .offset(CONVERSION_OFFSET), .in(three_x), .out(xFloat));
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE))
+        yToFloat (.clk(clk), .ce(ce), .offset(CONVERSION_OFFSET), .in(three_y), .out(yFloat));
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE))
+        angleToFloat (.clk(clk), .ce(ce), .offset(CONVERSION_OFFSET), .in(three_z), .out(angleFloat));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 6
+    // Scale back, handle Inf and NaN
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [EXPONENT_SIZE - 1 : 0]    exponentDelayed;
+    wire                            nanDelayed;
+    wire                            infDelayed;
+    wire                            zeroDelayed;
+
+    ValueDelay #(.VALUE_SIZE(EXPONENT_SIZE + 3), .DELAY(LATENCY - 1)) 
+        flagsDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ 
+                exponentMax, 
+                xNan || yNan || angleSpecial, 
+                exponentMax == EXPONENT_MAX[0 +: EXPONENT_SIZE],
+                exponentMax == 0
+            }), 
+            .out({ exponentDelayed, nanDelayed, infDelayed, zeroDelayed })
+        );
+
+    always @(posedge clk)
+    if (ce) begin
+        if (VECTORING)
+        begin
+            if (nanDelayed || infDelayed)
+            begin
+                xOut <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], nanDelayed, { (MANTISSA_SIZE - 1) { nanDelayed } } };
+                angleOut <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+            end
+            else
+            begin
+                xOut <= rescale(xFloat, exponentDelayed);
+                // The iterations can't find the angle of a zero vector: atan2(0, 0) = 0
+                angleOut <= (zeroDelayed) ? 0 : angleFloat;
+            end
+            yOut <= 0;
+        end
+        else
+        begin
+            if (nanDelayed || infDelayed)
+            begin
+                xOut <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+                yOut <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+            end
+            else
+            begin
+                xOut <= rescale(xFloat, exponentDelayed);
+                yOut <= rescale(yFloat, exponentDelayed);
+            end
+            angleOut <= 0;
+        end
+    end
+endmodule
@@ -0,0 +1,183 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point 2 ** x
+// x is converted into a fixed point number. The integer part is directly used as exponent
+// of the result. 2 ** fraction (1.0 .. 2.0) is calculated with the FixedFunction which uses
+// a table of polynomials. TABLE_SIZE_LOG2 and DEGREE configure the accuracy (see FixedFunction).
+// GUARD_SIZE is the number of additional fraction bits of the fixed point calculation.
+// Measured error for a float (s=1, e=8, m=23):
+//  - TABLE_SIZE_LOG2 = 8, DEGREE = 2: < 0.6 ulp
+//  - TABLE_SIZE_LOG2 = 5, DEGREE = 3: < 0.7 ulp
+// Results which would be denormalized numbers are flushed to zero. 2 ** Inf is Inf,
+// 2 ** -Inf is zero and 2 ** NaN is NaN.
+// This module is pipelined. It can calculate one 2 ** x per clock
+// This module has a latency of DEGREE + 3 clock cycles
+module FloatExp2
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter TABLE_SIZE_LOG2 = 8,
+    parameter DEGREE = 2,
+    parameter GUARD_SIZE = 6,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_EXP2_LATENCY(DEGREE)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    in,
+    output reg  [FLOAT_SIZE - 1 : 0]    out
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam EXPONENT_MAX = (2 ** EXPONENT_SIZE) - 1; // Inf and NaN
+
+    localparam FRACTION_SIZE = MANTISSA_SIZE + GUARD_SIZE;
+    localparam INTEGER_SIZE = EXPONENT_SIZE + 1; // Signed integer part of x
+    localparam MAGNITUDE_SIZE = EXPONENT_SIZE + FRACTION_SIZE; // Unsigned x in fixed point
+    localparam FIXED_SIZE = INTEGER_SIZE + FRACTION_SIZE; // Signed x in fixed point
+    localparam VALUE_SIZE = FRACTION_SIZE + 3; // See FixedFunction
+    localparam EXPONENT_CALC_SIZE = EXPONENT_SIZE + 2;
+    localparam PACKED_SIZE = EXPONENT_CALC_SIZE + MANTISSA_SIZE;
+    localparam FLAGS_SIZE = INTEGER_SIZE + 3;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Convert x into a fixed point number
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [INTEGER_SIZE - 1 : 0]     one_integer;
+    reg  [FRACTION_SIZE - 1 : 0]    one_fraction;
+    reg                             one_overflow;
+    reg                             one_sign;
+    reg                             one_nan;
+    always @(posedge clk)
+    if (ce) begin : Unpack
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] exponent;
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] shift;
+        reg        [MAGNITUDE_SIZE - 1 : 0]     magnitude;
+        reg        [FIXED_SIZE - 1 : 0]         fixed;
+
+        exponent = $signed({ 2'b0, in[EXPONENT_POS +: EXPONENT_SIZE] }) - EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE];
+        magnitude = { { (MAGNITUDE_SIZE - MANTISSA_SIZE - 1) { 1'b0 } }, in[EXPONENT_POS +: EXPONENT_SIZE] != 0, in[MANTISSA_POS +: MANTISSA_SIZE] };
+
+        // The mantissa has already MANTISSA_SIZE fraction bits
+        shift = exponent + GUARD_SIZE[0 +: EXPONENT_CALC_SIZE];
+        if (shift >= 0)
+        begin
+            magnitude = magnitude << shift;
+        end
+        else
+        begin
+            magnitude = magnitude >> (-shift);
+        end
+
+        fixed = { 1'b0, magnitude };
+        if (in[SIGN_POS])
+        begin
+            fixed = ~fixed + 1;
+        end
+
+        // The integer part of a negative number is rounded towards -Inf, the fraction stays positive
+        one_integer <= fixed[FRACTION_SIZE +: INTEGER_SIZE];
+        one_fraction <= fixed[0 +: FRACTION_SIZE];
+        // The result is either Inf or zero
+        one_overflow <= exponent >= $signed(EXPONENT_SIZE[0 +: EXPONENT_CALC_SIZE]);
+        one_sign <= in[SIGN_POS];
+        one_nan <= (in[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]) && (in[MANTISSA_POS +: MANTISSA_SIZE] != 0);
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Calculate 2 ** fraction
+    // Clocks: FIXED_FUNCTION_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [VALUE_SIZE - 1 : 0]       power;
+    wire [INTEGER_SIZE - 1 : 0]     integerDelayed;
+    wire                            overflowDelayed;
+    wire                            signDelayed;
+    wire                            nanDelayed;
+
+    FixedFunction #(
+        .FUNCTION("EXP2"),
+        .X_SIZE(FRACTION_SIZE),
+        .TABLE_SIZE_LOG2(TABLE_SIZE_LOG2),
+        .DEGREE(DEGREE),
+        .FRACTION_SIZE(FRACTION_SIZE)
+    ) exp2 (
+        .clk(clk),
+        .ce(ce),
+        .x(one_fraction),
+        .y(power)
+    );
+
+    ValueDelay #(.VALUE_SIZE(FLAGS_SIZE), .DELAY(`FIXED_FUNCTION_LATENCY(DEGREE))) 
+        flagsDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ one_integer, one_overflow, one_sign, one_nan }), 
+            .out({ integerDelayed, overflowDelayed, signDelayed, nanDelayed })
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Round and pack the result
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    always @(posedge clk)
+    if (ce) begin : Pack
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] exponent;
+        reg        [PACKED_SIZE - 1 : 0]        packed;
+
+        exponent = $signed({ integerDelayed[INTEGER_SIZE - 1], integerDelayed }) + EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE];
+
+        // Round to nearest. An overflow of the mantissa increments the exponent.
+        packed = { exponent, power[FRACTION_SIZE - 1 -: MANTISSA_SIZE] } 
+            + { { (PACKED_SIZE - 1) { 1'b0 } }, power[FRACTION_SIZE - 1 - MANTISSA_SIZE] };
+        // The polynomial was rounded up to 2.0
+        if (power[FRACTION_SIZE + 1])
+        begin
+            packed = { exponent + 1'b1, { MANTISSA_SIZE { 1'b0 } } };
+        end
+
+        if (nanDelayed)
+        begin
+            out <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+        end
+        else if (overflowDelayed)
+        begin
+            out <= (signDelayed) ? { FLOAT_SIZE { 1'b0 } } : { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b0 } } };
+        end
+        else if (exponent <= 0)
+        begin
+            out <= 0;
+        end
+        else if (packed[MANTISSA_SIZE +: EXPONENT_CALC_SIZE] >= EXPONENT_MAX[0 +: EXPONENT_CALC_SIZE])
+        begin
+            out <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b0 } } };
+        end
+        else
+        begin
+            out <= { 1'b0, packed[MANTISSA_SIZE +: EXPONENT_SIZE], packed[0 +: MANTISSA_SIZE] };
+        end
+    end
+endmodule
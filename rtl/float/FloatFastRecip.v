@@ -15,16 +15,22 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Floating point reciprocal
 // This module is pipelined. It can calculate one reciprocal per clock
 // This module uses an magic algorithm to calculate that. It has an error of around 5%
 // Refer to https://en.wikipedia.org/wiki/Fast_inverse_square_root
+// With USE_SQUARE, the square is calculated with a FloatSquare instead of a FloatMul. It requires no DSPs.
+// The default is the FloatMul.
 // This module has a latency of 4 clock cycles
 module FloatFastRecip 
 # (
     parameter MANTISSA_SIZE = 23,
+    parameter USE_SQUARE = 0,
     localparam EXPONENT_SIZE = 8, // To make the implementation a bit more simple, disallow exponent adaption
-    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_FAST_RECIP_LATENCY
 )
 (
     input  wire                      clk,
@@ -40,18 +46,39 @@ module FloatFastRecip
         inSub <= (MAGIC_NUMBER[0 +: FLOAT_SIZE] - in) >> 1;
     end
 
-    FloatMul 
-    #(
-        .MANTISSA_SIZE(MANTISSA_SIZE),
-        .EXPONENT_SIZE(EXPONENT_SIZE),
-        .DELAY(1)
-    ) 
-    floatMul 
-    (
-        .clk(clk),
-        .ce(ce),
-        .facAIn(inSub),
-        .facBIn(inSub),
-        .prod(out)
-    );
+    generate
+        if (USE_SQUARE)
+        begin
+            FloatSquare 
+            #(
+                .MANTISSA_SIZE(MANTISSA_SIZE),
+                .EXPONENT_SIZE(EXPONENT_SIZE),
+                .DELAY(0)
+            ) 
+            floatSquare 
+            (
+                .clk(clk),
+                .ce(ce),
+                .in(inSub),
+                .square(out)
+            );
+        end
+        else
+        begin
+            FloatMul 
+            #(
+                .MANTISSA_SIZE(MANTISSA_SIZE),
+                .EXPONENT_SIZE(EXPONENT_SIZE),
+                .DELAY(1)
+            ) 
+            floatMul 
+            (
+                .clk(clk),
+                .ce(ce),
+                .facAIn(inSub),
+                .facBIn(inSub),
+                .prod(out)
+            );
+        end
+    endgenerate
 endmodule
\ No newline at end of file
@@ -0,0 +1,148 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Streaming radix-2 FFT with single-path delay feedback (R2SDF, decimation in frequency).
+// The FFT has 2 ** SIZE_LOG2 points. Every stage consists of a FloatFftButterfly and,
+// except the last stage, a FloatFftTwiddle. The delay lines of the stages have the
+// lengths SIZE / 2, SIZE / 4, ... 1.
+// One complex sample is streamed in and one is streamed out per clock. The first sample
+// after the reset is the first sample of a frame, the following frames directly follow
+// each other. The output is in bit reversed order. 'outIndex' contains the index of the
+// frequency bin which is currently in 'outRe' and 'outIm'. 'outValid' is set when the
+// first frame after the reset leaves the FFT.
+// This module is pipelined. It can calculate one sample per clock
+// This module has a latency of SIZE - 1 + (SIZE_LOG2 * 5) + ((SIZE_LOG2 - 1) * (12 + MUL_DELAY)) clock cycles
+module FloatFft
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter SIZE_LOG2 = 6,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam SIZE = 2 ** SIZE_LOG2,
+    localparam LATENCY = `FLOAT_FFT_LATENCY(SIZE_LOG2, MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         resetn,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    inRe,
+    input  wire [FLOAT_SIZE - 1 : 0]    inIm,
+    output wire [FLOAT_SIZE - 1 : 0]    outRe,
+    output wire [FLOAT_SIZE - 1 : 0]    outIm,
+    output reg  [SIZE_LOG2 - 1 : 0]     outIndex,
+    output wire                         outValid
+);
+    localparam BUTTERFLY_LATENCY = `FLOAT_ADD_SUB_LATENCY + 1; // Without the delay line
+    localparam TWIDDLE_LATENCY = `FLOAT_FFT_TWIDDLE_LATENCY(MUL_DELAY);
+    localparam FILL_SIZE = $clog2(LATENCY + 1);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Frame counter
+    // The stages derive their position in the frame from this counter
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [SIZE_LOG2 - 1 : 0]    count = 0;
+    reg  [FILL_SIZE - 1 : 0]    fill = 0;
+    always @(posedge clk)
+    begin
+        if (!resetn)
+        begin
+            count <= 0;
+            fill <= 0;
+        end
+        else if (ce)
+        begin
+            count <= count + 1;
+            if (!outValid)
+            begin
+                fill <= fill + 1;
+            end
+        end
+    end
+    assign outValid = fill == LATENCY[0 +: FILL_SIZE];
+
+    always @(*)
+    begin : BitReverse
+        integer i;
+        reg [SIZE_LOG2 - 1 : 0] position;
+
+        position = count - LATENCY[0 +: SIZE_LOG2];
+        for (i = 0; i < SIZE_LOG2; i = i + 1)
+        begin
+            outIndex[i] = position[SIZE_LOG2 - 1 - i];
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Stages
+    ////////////////////////////////////////////////////////////////////////////
+    wire [((SIZE_LOG2 + 1) * FLOAT_SIZE) - 1 : 0] res;
+    wire [((SIZE_LOG2 + 1) * FLOAT_SIZE) - 1 : 0] ims;
+
+    assign res[0 +: FLOAT_SIZE] = inRe;
+    assign ims[0 +: FLOAT_SIZE] = inIm;
+
+    generate
+        genvar s;
+        for (s = 0; s < SIZE_LOG2; s = s + 1)
+        begin : Stage
+            localparam DELAY = SIZE >> (s + 1);
+            // Latency of the previous stages
+            localparam OFFSET = (SIZE - (SIZE >> s)) + (s * (BUTTERFLY_LATENCY + TWIDDLE_LATENCY));
+            localparam TWIDDLE_OFFSET = OFFSET + DELAY + BUTTERFLY_LATENCY;
+            wire [SIZE_LOG2 - 1 : 0]    position = count - OFFSET[0 +: SIZE_LOG2];
+            wire [SIZE_LOG2 - 1 : 0]    twiddlePosition = count - TWIDDLE_OFFSET[0 +: SIZE_LOG2];
+            wire [FLOAT_SIZE - 1 : 0]   butterflyRe;
+            wire [FLOAT_SIZE - 1 : 0]   butterflyIm;
+
+            FloatFftButterfly #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(DELAY))
+                butterfly (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .second(position[SIZE_LOG2 - 1 - s]), 
+                    .inRe(res[s * FLOAT_SIZE +: FLOAT_SIZE]), 
+                    .inIm(ims[s * FLOAT_SIZE +: FLOAT_SIZE]), 
+                    .outRe(butterflyRe), 
+                    .outIm(butterflyIm)
+                );
+
+            if (s < (SIZE_LOG2 - 1))
+            begin
+                FloatFftTwiddle #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(DELAY), .MUL_DELAY(MUL_DELAY))
+                    twiddle (
+                        .clk(clk), 
+                        .ce(ce), 
+                        .index(twiddlePosition[0 +: SIZE_LOG2 - s]), 
+                        .inRe(butterflyRe), 
+                        .inIm(butterflyIm), 
+                        .outRe(res[(s + 1) * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .outIm(ims[(s + 1) * FLOAT_SIZE +: FLOAT_SIZE])
+                    );
+            end
+            else
+            begin
+                assign res[(s + 1) * FLOAT_SIZE +: FLOAT_SIZE] = butterflyRe;
+                assign ims[(s + 1) * FLOAT_SIZE +: FLOAT_SIZE] = butterflyIm;
+            end
+        end
+    endgenerate
+
+    assign outRe = res[SIZE_LOG2 * FLOAT_SIZE +: FLOAT_SIZE];
+    assign outIm = ims[SIZE_LOG2 * FLOAT_SIZE +: FLOAT_SIZE];
+endmodule
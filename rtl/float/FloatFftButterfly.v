@@ -0,0 +1,121 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Radix-2 butterfly with a single-path delay feedback (SDF) for a streaming FFT (see FloatFft).
+// The samples are processed in blocks of 2 * DELAY samples. 'second' must be set for the samples
+// in the second half of a block. The butterfly calculates x[n] + x[n + DELAY] and x[n] - x[n + DELAY]
+// of the samples of a block. In the output, the sums fill the first half of the block, the
+// differences the second half.
+// The first half of a block is stored in a delay line. In the second half, the sums are streamed
+// out and the differences are fed back into the delay line, while the differences of the
+// previous block are streamed out. To compensate the latency of the FloatAddSub in the feedback
+// loop, the delay line is shortened by FLOAT_ADD_SUB_LATENCY. When DELAY is smaller than this
+// latency, the feedback is not possible. Then the first half of the block and the differences
+// are stored in two delay lines (feedforward).
+// This module is pipelined. It can calculate one sample per clock
+// This module has a latency of DELAY + 5 clock cycles
+module FloatFftButterfly
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter DELAY = 1, // Distance of the operands of the butterfly
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_FFT_BUTTERFLY_LATENCY(DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire                         second,
+    input  wire [FLOAT_SIZE - 1 : 0]    inRe,
+    input  wire [FLOAT_SIZE - 1 : 0]    inIm,
+    output reg  [FLOAT_SIZE - 1 : 0]    outRe,
+    output reg  [FLOAT_SIZE - 1 : 0]    outIm
+);
+    localparam ADD_LATENCY = `FLOAT_ADD_SUB_LATENCY;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Butterfly of x[n] (a) and x[n + DELAY] (in)
+    // Clocks: FLOAT_ADD_SUB_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [(2 * FLOAT_SIZE) - 1 : 0] a;
+    wire [(2 * FLOAT_SIZE) - 1 : 0] sum;
+    wire [(2 * FLOAT_SIZE) - 1 : 0] diff;
+    wire                            secondDelayed;
+
+    FloatAddSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        reAddSub (.clk(clk), .ce(ce), .aIn(a[0 +: FLOAT_SIZE]), .bIn(inRe), .sum(sum[0 +: FLOAT_SIZE]), .diff(diff[0 +: FLOAT_SIZE]));
+
+    FloatAddSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        imAddSub (.clk(clk), .ce(ce), .aIn(a[FLOAT_SIZE +: FLOAT_SIZE]), .bIn(inIm), .sum(sum[FLOAT_SIZE +: FLOAT_SIZE]), .diff(diff[FLOAT_SIZE +: FLOAT_SIZE]));
+
+    ValueDelay #(.VALUE_SIZE(1), .DELAY(ADD_LATENCY)) 
+        secondDelay (.clk(clk), .ce(ce), .in(second), .out(secondDelayed));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Delay lines and selection of the result
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [(2 * FLOAT_SIZE) - 1 : 0] result;
+
+    generate
+        if (DELAY >= ADD_LATENCY)
+        begin : Feedback
+            wire [(2 * FLOAT_SIZE) - 1 : 0] feedback;
+            wire [(2 * FLOAT_SIZE) - 1 : 0] aDelayed;
+            wire [(2 * FLOAT_SIZE) - 1 : 0] inDelayed;
+
+            // First half: store the samples, second half: store the differences
+            assign feedback = (secondDelayed) ? diff : inDelayed;
+
+            ValueDelay #(.VALUE_SIZE(2 * FLOAT_SIZE), .DELAY(DELAY - ADD_LATENCY)) 
+                feedbackDelay (.clk(clk), .ce(ce), .in(feedback), .out(a));
+
+            ValueDelay #(.VALUE_SIZE(4 * FLOAT_SIZE), .DELAY(ADD_LATENCY)) 
+                operandDelay (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .in({ a, inIm, inRe }), 
+                    .out({ aDelayed, inDelayed })
+                );
+
+            // In the first half, a contains the differences of the previous block
+            assign result = (secondDelayed) ? sum : aDelayed;
+        end
+        else
+        begin : Feedforward
+            wire [(2 * FLOAT_SIZE) - 1 : 0] diffDelayed;
+
+            ValueDelay #(.VALUE_SIZE(2 * FLOAT_SIZE), .DELAY(DELAY)) 
+                operandDelay (.clk(clk), .ce(ce), .in({ inIm, inRe }), .out(a));
+
+            ValueDelay #(.VALUE_SIZE(2 * FLOAT_SIZE), .DELAY(DELAY)) 
+                diffDelay (.clk(clk), .ce(ce), .in(diff), .out(diffDelayed));
+
+            assign result = (secondDelayed) ? sum : diffDelayed;
+        end
+    endgenerate
+
+    always @(posedge clk)
+    if (ce) begin : Select
+        outRe <= result[0 +: FLOAT_SIZE];
+        outIm <= result[FLOAT_SIZE +: FLOAT_SIZE];
+    end
+endmodule
@@ -0,0 +1,161 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Multiplies the output of a FloatFftButterfly with the twiddle factors of a radix-2 FFT
+// (decimation in frequency). 'index' is the position of the sample in the block of 2 * DELAY
+// samples. The sums in the first half of the block are not multiplied. The difference n in the
+// second half is multiplied with exp(-i * pi * n / DELAY). The twiddle factors are calculated
+// while elaborating and stored in a ROM. Trivial twiddle factors (sums and n = 0) bypass the
+// FloatComplexMul, so that these samples are not changed.
+// DELAY must be at least 2.
+// This module is pipelined. It can calculate one sample per clock
+// This module has a latency of 12 + MUL_DELAY clock cycles
+module FloatFftTwiddle
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter DELAY = 2, // DELAY of the FloatFftButterfly in front of this module
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam INDEX_SIZE = $clog2(DELAY) + 1,
+    localparam LATENCY = `FLOAT_FFT_TWIDDLE_LATENCY(MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [INDEX_SIZE - 1 : 0]    index,
+    input  wire [FLOAT_SIZE - 1 : 0]    inRe,
+    input  wire [FLOAT_SIZE - 1 : 0]    inIm,
+    output reg  [FLOAT_SIZE - 1 : 0]    outRe,
+    output reg  [FLOAT_SIZE - 1 : 0]    outIm
+);
+    localparam N_SIZE = INDEX_SIZE - 1;
+    localparam BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam real PI = 3.141592653589793;
+
+    // Rounds a real number to the float format. The magnitude must be smaller or equal to 1.0.
+    // Values below the rounding error of 1.0 (like cos(pi / 2)) are flushed to zero.
+    function [FLOAT_SIZE - 1 : 0] realToFloat;
+        input real value;
+        real magnitude;
+        integer exponent;
+        integer i;
+        begin
+            realToFloat = 0;
+            magnitude = (value < 0.0) ? -value : value;
+            if (magnitude >= (2.0 ** -(MANTISSA_SIZE + 2)))
+            begin
+                exponent = 0;
+                while (magnitude < 1.0)
+                begin
+                    magnitude = magnitude * 2.0;
+                    exponent = exponent - 1;
+                end
+                magnitude = $floor(((magnitude - 1.0) * (2.0 ** MANTISSA_SIZE)) + 0.5);
+                if (magnitude >= (2.0 ** MANTISSA_SIZE))
+                begin
+                    magnitude = 0.0;
+                    exponent = exponent + 1;
+                end
+                for (i = MANTISSA_SIZE - 1; i >= 0; i = i - 1)
+                begin
+                    realToFloat[i] = magnitude >= (2.0 ** i);
+                    if (realToFloat[i])
+                    begin
+                        magnitude = magnitude - (2.0 ** i);
+                    end
+                end
+                exponent = exponent + BIAS;
+                realToFloat[MANTISSA_SIZE +: EXPONENT_SIZE] = exponent[0 +: EXPONENT_SIZE];
+                realToFloat[FLOAT_SIZE - 1] = value < 0.0;
+            end
+        end
+    endfunction
+
+    // { im, re } of exp(-i * pi * n / DELAY)
+    (* rom_style = "block" *) reg [(2 * FLOAT_SIZE) - 1 : 0] twiddleTable [0 : DELAY - 1];
+    initial
+    begin : InitTable
+        integer n;
+        for (n = 0; n < DELAY; n = n + 1)
+        begin
+            twiddleTable[n] = { realToFloat(-$sin(PI * $itor(n) / $itor(DELAY))), realToFloat($cos(PI * $itor(n) / $itor(DELAY))) };
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Read the twiddle factor
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [(2 * FLOAT_SIZE) - 1 : 0] one_twiddle;
+    reg  [FLOAT_SIZE - 1 : 0]       one_re;
+    reg  [FLOAT_SIZE - 1 : 0]       one_im;
+    reg                             one_bypass;
+    always @(posedge clk)
+    if (ce) begin : ReadTwiddle
+        one_twiddle <= twiddleTable[index[0 +: N_SIZE]];
+        one_re <= inRe;
+        one_im <= inIm;
+        one_bypass <= !index[N_SIZE] || (index[0 +: N_SIZE] == 0);
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Multiplication
+    // Clocks: FLOAT_COMPLEX_MUL_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    localparam MUL_LATENCY = `FLOAT_COMPLEX_MUL_LATENCY(MUL_DELAY);
+    wire [FLOAT_SIZE - 1 : 0]   prodRe;
+    wire [FLOAT_SIZE - 1 : 0]   prodIm;
+    wire [FLOAT_SIZE - 1 : 0]   bypassRe;
+    wire [FLOAT_SIZE - 1 : 0]   bypassIm;
+    wire                        bypass;
+
+    FloatComplexMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .MUL_DELAY(MUL_DELAY))
+        twiddleMul (
+            .clk(clk), 
+            .ce(ce), 
+            .aRe(one_re), 
+            .aIm(one_im), 
+            .bRe(one_twiddle[0 +: FLOAT_SIZE]), 
+            .bIm(one_twiddle[FLOAT_SIZE +: FLOAT_SIZE]), 
+            .re(prodRe), 
+            .im(prodIm)
+        );
+
+    ValueDelay #(.VALUE_SIZE(1 + (2 * FLOAT_SIZE)), .DELAY(MUL_LATENCY)) 
+        bypassDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ one_bypass, one_im, one_re }), 
+            .out({ bypass, bypassIm, bypassRe })
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Select the result
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    always @(posedge clk)
+    if (ce) begin : Select
+        outRe <= (bypass) ? bypassRe : prodRe;
+        outIm <= (bypass) ? bypassIm : prodIm;
+    end
+endmodule
@@ -0,0 +1,211 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// FIR filter in transposed form: y[n] = h[0] * x[n] + h[1] * x[n - 1] + ... + h[TAPS - 1] * x[n - TAPS + 1]
+// Every tap has a multiplier and an adder which adds the product to the partial sum of the next
+// tap. There is no long adder chain between two registers, so the number of taps does not limit
+// the clock frequency. The partial sums require FLOAT_ADD_LATENCY clocks from one tap to the next
+// instead of one. Therefore x is delayed with a chain of ValueDelays (FLOAT_ADD_LATENCY - 1 per tap)
+// before it is multiplied (systolic form). The last tap does not require an adder.
+// COEFFICIENTS contains the TAPS coefficients as floats, h[0] in the LSBs. The default is a binomial
+// low pass. COEFFICIENT_MODE selects the multipliers:
+//  - "PARAMETER": FloatMul with the coefficients from COEFFICIENTS
+//  - "CONST": FloatMulConst (shift and add network, no DSPs). MUL_DELAY must be at least 1.
+//  - "RAM": FloatMul with coefficients in registers. They are initialized with COEFFICIENTS and can
+//    be overwritten with 'coefficientWe'. 'coefficientAddr' is the index of the coefficient.
+//    The filter uses the new coefficient immediately, so the output is a mixture of both filters
+//    while the coefficients are updated.
+// SYMMETRIC folds the taps of a linear phase filter (h[k] = h[TAPS - 1 - k]). x[n - k] and
+// x[n - TAPS + 1 + k] are added with a FloatAdd before they are multiplied with h[k]. This halves
+// the number of multipliers. Only the first (TAPS + 1) / 2 coefficients are used.
+// This module is pipelined. It can filter one sample per clock
+// This module has a latency of (MULTIPLIERS * 3) + 3 + MUL_DELAY clock cycles (plus 4 if SYMMETRIC)
+module FloatFir
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter TAPS = 5,
+    parameter [(TAPS * (1 + EXPONENT_SIZE + MANTISSA_SIZE)) - 1 : 0] COEFFICIENTS = { 32'h3d800000, 32'h3e800000, 32'h3ec00000, 32'h3e800000, 32'h3d800000 },
+    parameter COEFFICIENT_MODE = "PARAMETER",
+    parameter SYMMETRIC = 0,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam MULTIPLIERS = `FLOAT_FIR_MULTIPLIERS(TAPS, SYMMETRIC),
+    localparam ADDR_SIZE = (TAPS > 1) ? $clog2(TAPS) : 1,
+    localparam LATENCY = `FLOAT_FIR_LATENCY(TAPS, SYMMETRIC, MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+
+    input  wire                         coefficientWe,
+    input  wire [ADDR_SIZE - 1 : 0]     coefficientAddr,
+    input  wire [FLOAT_SIZE - 1 : 0]    coefficientIn,
+
+    input  wire [FLOAT_SIZE - 1 : 0]    x,
+    output wire [FLOAT_SIZE - 1 : 0]    y
+);
+    localparam ADD_LATENCY = `FLOAT_ADD_LATENCY;
+
+    genvar k;
+
+    // Operands of the multipliers. Multiplier k uses x[n - k] (xa) and x[n - TAPS + 1 + k] (xb)
+    wire [(MULTIPLIERS * FLOAT_SIZE) - 1 : 0]           xa;
+    wire [(MULTIPLIERS * FLOAT_SIZE) - 1 : 0]           xb;
+    wire [(MULTIPLIERS * FLOAT_SIZE) - 1 : 0]           operands;
+    wire [(MULTIPLIERS * FLOAT_SIZE) - 1 : 0]           coefficients;
+    wire [(MULTIPLIERS * FLOAT_SIZE) - 1 : 0]           prods;
+    wire [(MULTIPLIERS * FLOAT_SIZE) - 1 : 0]           sums;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Coefficients
+    ////////////////////////////////////////////////////////////////////////////
+    generate
+        if (COEFFICIENT_MODE == "RAM")
+        begin
+            // All coefficients are read in parallel, so they can only be mapped into registers
+            reg  [FLOAT_SIZE - 1 : 0] coefficientRegs [0 : MULTIPLIERS - 1];
+            integer i;
+
+            initial
+            begin
+                for (i = 0; i < MULTIPLIERS; i = i + 1)
+                begin
+                    coefficientRegs[i] = COEFFICIENTS[i * FLOAT_SIZE +: FLOAT_SIZE];
+                end
+            end
+
+            always @(posedge clk)
+            begin
+                if (coefficientWe && (coefficientAddr < MULTIPLIERS))
+                begin
+                    coefficientRegs[coefficientAddr] <= coefficientIn;
+                end
+            end
+
+            for (k = 0; k < MULTIPLIERS; k = k + 1)
+            begin : Coefficient
+                assign coefficients[k * FLOAT_SIZE +: FLOAT_SIZE] = coefficientRegs[k];
+            end
+        end
+        else
+        begin
+            assign coefficients = COEFFICIENTS[0 +: MULTIPLIERS * FLOAT_SIZE];
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Delay lines of x and pre-addition of the symmetric taps
+    // Clocks: 0 or FLOAT_ADD_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    assign xa[(MULTIPLIERS - 1) * FLOAT_SIZE +: FLOAT_SIZE] = x;
+
+    generate
+        for (k = 0; k < MULTIPLIERS - 1; k = k + 1)
+        begin : DelayA
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(ADD_LATENCY - 1)) 
+                xDelay (.clk(clk), .ce(ce), .in(xa[(k + 1) * FLOAT_SIZE +: FLOAT_SIZE]), .out(xa[k * FLOAT_SIZE +: FLOAT_SIZE]));
+        end
+
+        if (SYMMETRIC)
+        begin
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(TAPS - 1 - (2 * (MULTIPLIERS - 1)))) 
+                xbDelay (.clk(clk), .ce(ce), .in(x), .out(xb[(MULTIPLIERS - 1) * FLOAT_SIZE +: FLOAT_SIZE]));
+
+            for (k = 0; k < MULTIPLIERS - 1; k = k + 1)
+            begin : DelayB
+                ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(ADD_LATENCY + 1)) 
+                    xDelay (.clk(clk), .ce(ce), .in(xb[(k + 1) * FLOAT_SIZE +: FLOAT_SIZE]), .out(xb[k * FLOAT_SIZE +: FLOAT_SIZE]));
+            end
+
+            for (k = 0; k < MULTIPLIERS; k = k + 1)
+            begin : PreAdd
+                if ((2 * k) == (TAPS - 1))
+                begin
+                    // Middle tap of an odd number of taps
+                    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(ADD_LATENCY)) 
+                        middleDelay (.clk(clk), .ce(ce), .in(xa[k * FLOAT_SIZE +: FLOAT_SIZE]), .out(operands[k * FLOAT_SIZE +: FLOAT_SIZE]));
+                end
+                else
+                begin
+                    FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                        preAdd (
+                            .clk(clk), 
+                            .ce(ce), 
+                            .aIn(xa[k * FLOAT_SIZE +: FLOAT_SIZE]), 
+                            .bIn(xb[k * FLOAT_SIZE +: FLOAT_SIZE]), 
+                            .sum(operands[k * FLOAT_SIZE +: FLOAT_SIZE])
+                        );
+                end
+            end
+        end
+        else
+        begin
+            assign operands = xa;
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Multiplication and accumulation of the partial sums (transposed form)
+    // Clocks: FLOAT_MUL_LATENCY + (MULTIPLIERS * (FLOAT_ADD_LATENCY - 1)) + 1
+    ////////////////////////////////////////////////////////////////////////////
+    generate
+        for (k = 0; k < MULTIPLIERS; k = k + 1)
+        begin : Tap
+            if (COEFFICIENT_MODE == "CONST")
+            begin
+                FloatMulConst #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .CONSTANT(COEFFICIENTS[k * FLOAT_SIZE +: FLOAT_SIZE]), .DELAY(MUL_DELAY - 1))
+                    mul (.clk(clk), .ce(ce), .in(operands[k * FLOAT_SIZE +: FLOAT_SIZE]), .prod(prods[k * FLOAT_SIZE +: FLOAT_SIZE]));
+            end
+            else
+            begin
+                FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                    mul (
+                        .clk(clk), 
+                        .ce(ce), 
+                        .facAIn(operands[k * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .facBIn(coefficients[k * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .prod(prods[k * FLOAT_SIZE +: FLOAT_SIZE])
+                    );
+            end
+
+            if (k == (MULTIPLIERS - 1))
+            begin
+                // Nothing to add, just keep the timing of the adders
+                ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(ADD_LATENCY)) 
+                    sumDelay (.clk(clk), .ce(ce), .in(prods[k * FLOAT_SIZE +: FLOAT_SIZE]), .out(sums[k * FLOAT_SIZE +: FLOAT_SIZE]));
+            end
+            else
+            begin
+                FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                    add (
+                        .clk(clk), 
+                        .ce(ce), 
+                        .aIn(prods[k * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .bIn(sums[(k + 1) * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .sum(sums[k * FLOAT_SIZE +: FLOAT_SIZE])
+                    );
+            end
+        end
+    endgenerate
+
+    assign y = sums[0 +: FLOAT_SIZE];
+endmodule
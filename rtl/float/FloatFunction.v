@@ -0,0 +1,212 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point evaluation of a function f(x) with a table of polynomials
+// The sign, the exponent and the upper bits of the mantissa of x select a segment. Every segment
+// has a polynomial of the degree DEGREE, which is evaluated in fixed point with the FixedFunction.
+// The result is converted with IntToFloat and scaled with the exponent of the segment. Because of
+// the exponent, the error is relative to the biggest result of a segment.
+// The segments are:
+//  - |x| < 2 ** EXPONENT_MIN: 2 ** SEGMENT_MANTISSA_BITS segments. x is used as a fixed point
+//    number with MANTISSA_SIZE fraction bits (scaled with 2 ** -EXPONENT_MIN).
+//  - 2 ** EXPONENT_MIN <= |x| < 2 ** SEGMENT_EXPONENT_MAX: 2 ** SEGMENT_MANTISSA_BITS segments per
+//    exponent. SEGMENT_EXPONENT_MAX is EXPONENT_MIN + (2 ** SEGMENT_EXPONENT_BITS) - 1.
+//  - |x| >= 2 ** SEGMENT_EXPONENT_MAX: The last segment is used with the biggest position in the
+//    segment, so the result is f evaluated near the top of the last binade. This is only correct
+//    for functions which saturate (like tanh or sigmoid). Functions which don't saturate (like
+//    gelu, silu, softplus or exp) return wrong results for these inputs.
+// The coefficients are stored in COEFFICIENTS_FILE (see FixedFunction), the exponents of the
+// segments in SCALES_FILE (one signed EXPONENT_SIZE bit exponent per line). Both files are 
+// generated with the Tools/FloatFunctionGenerator, which also prints the parameters.
+// The segment index is { sign, exponent index, upper mantissa bits }.
+// Denormalized numbers are handled like zero. Results which are too small for a normalized 
+// float are flushed to zero. NaN results in NaN.
+// This module is pipelined. It can calculate one f(x) per clock
+// This module has a latency of DEGREE + 7 clock cycles
+module FloatFunction
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter EXPONENT_MIN = -8,
+    parameter SEGMENT_EXPONENT_BITS = 4,
+    parameter SEGMENT_MANTISSA_BITS = 4, // Must be smaller than MANTISSA_SIZE
+    parameter DEGREE = 2,
+    parameter GUARD_SIZE = 6,
+    parameter COEFFICIENTS_FILE = "",
+    parameter SCALES_FILE = "",
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_FUNCTION_LATENCY(DEGREE)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    in,
+    output reg  [FLOAT_SIZE - 1 : 0]    out
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam EXPONENT_MAX = (2 ** EXPONENT_SIZE) - 1; // Inf and NaN
+    localparam EXPONENT_CALC_SIZE = EXPONENT_SIZE + 2;
+
+    localparam FRACTION_SIZE = MANTISSA_SIZE + GUARD_SIZE;
+    localparam VALUE_SIZE = FRACTION_SIZE + 3; // See FixedFunction
+    localparam INDEX_COUNT = 2 ** SEGMENT_EXPONENT_BITS;
+    localparam SEGMENT_EXPONENT_MAX = EXPONENT_MIN + INDEX_COUNT - 1;
+    localparam TABLE_SIZE_LOG2 = 1 + SEGMENT_EXPONENT_BITS + SEGMENT_MANTISSA_BITS;
+    localparam TABLE_SIZE = 2 ** TABLE_SIZE_LOG2;
+    localparam X_SIZE = 1 + SEGMENT_EXPONENT_BITS + MANTISSA_SIZE;
+    localparam signed [EXPONENT_SIZE - 1 : 0] INT_TO_FLOAT_OFFSET = -FRACTION_SIZE;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Find the segment and the position in the segment
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [X_SIZE - 1 : 0]   one_x;
+    always @(posedge clk)
+    if (ce) begin : Segment
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] exponent;
+        reg        [EXPONENT_CALC_SIZE - 1 : 0] shift;
+        reg        [MANTISSA_SIZE : 0]          mantissa;
+        reg        [SEGMENT_EXPONENT_BITS - 1 : 0] index;
+        reg        [MANTISSA_SIZE - 1 : 0]      position;
+
+        exponent = $signed({ 2'b0, in[EXPONENT_POS +: EXPONENT_SIZE] }) - EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE];
+        if (in[EXPONENT_POS +: EXPONENT_SIZE] == 0)
+        begin
+            // Zero and denormalized numbers
+            index = 0;
+            position = 0;
+        end
+        else if (exponent < EXPONENT_MIN)
+        begin
+            // Fixed point: x * 2 ** -EXPONENT_MIN
+            shift = EXPONENT_MIN[0 +: EXPONENT_CALC_SIZE] - exponent;
+            mantissa = { 1'b1, in[MANTISSA_POS +: MANTISSA_SIZE] } >> shift;
+            index = 0;
+            position = mantissa[0 +: MANTISSA_SIZE];
+        end
+        else if (exponent >= SEGMENT_EXPONENT_MAX)
+        begin
+            // Saturate
+            index = INDEX_COUNT - 1;
+            position = { MANTISSA_SIZE { 1'b1 } };
+        end
+        else
+        begin
+            index = exponent - EXPONENT_MIN[0 +: EXPONENT_CALC_SIZE] + 1;
+            position = in[MANTISSA_POS +: MANTISSA_SIZE];
+        end
+        one_x <= { in[SIGN_POS], index, position };
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Evaluate the polynomial of the segment
+    // Clocks: FIXED_FUNCTION_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [VALUE_SIZE - 1 : 0]       value;
+    wire [EXPONENT_SIZE - 1 : 0]    scaleDelayed;
+
+    FixedFunction #(
+        .FUNCTION("FILE"),
+        .X_SIZE(X_SIZE),
+        .TABLE_SIZE_LOG2(TABLE_SIZE_LOG2),
+        .DEGREE(DEGREE),
+        .FRACTION_SIZE(FRACTION_SIZE),
+        .COEFFICIENTS_FILE(COEFFICIENTS_FILE)
+    ) polynomial (
+        .clk(clk),
+        .ce(ce),
+        .x(one_x),
+        .y(value)
+    );
+
+    (* rom_style = "block" *) reg [EXPONENT_SIZE - 1 : 0] scaleTable [0 : TABLE_SIZE - 1];
+    initial
+    begin
+        $readmemh(SCALES_FILE, scaleTable);
+    end
+
+    // Read together with the coefficients and delayed until the conversion is done
+    reg  [EXPONENT_SIZE - 1 : 0]    two_scale;
+    always @(posedge clk)
+    if (ce) begin
+        two_scale <= scaleTable[one_x[X_SIZE - TABLE_SIZE_LOG2 +: TABLE_SIZE_LOG2]];
+    end
+
+    ValueDelay #(.VALUE_SIZE(EXPONENT_SIZE), .DELAY(DEGREE + `INT_TO_FLOAT_LATENCY)) 
+        scaleDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in(two_scale), 
+            .out(scaleDelayed)
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Convert the result into a float
+    // Clocks: INT_TO_FLOAT_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]   valueFloat;
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE))
+        valueToFloat (.clk(clk), .ce(ce), .offset(INT_TO_FLOAT_OFFSET), .in(value), .out(valueFloat));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Scale the result with the exponent of the segment, handle NaN
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire nanDelayed;
+
+    ValueDelay #(.VALUE_SIZE(1), .DELAY(LATENCY - 1)) 
+        nanDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in((in[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]) && (in[MANTISSA_POS +: MANTISSA_SIZE] != 0)), 
+            .out(nanDelayed)
+        );
+
+    always @(posedge clk)
+    if (ce) begin : Scale
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] exponent;
+
+        exponent = $signed({ 2'b0, valueFloat[EXPONENT_POS +: EXPONENT_SIZE] }) 
+            + $signed({ { 2 { scaleDelayed[EXPONENT_SIZE - 1] } }, scaleDelayed });
+        if (nanDelayed)
+        begin
+            out <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+        end
+        else if ((valueFloat[EXPONENT_POS +: EXPONENT_SIZE] == 0) || (exponent <= 0))
+        begin
+            out <= { valueFloat[SIGN_POS], { (FLOAT_SIZE - 1) { 1'b0 } } };
+        end
+        else if (exponent >= EXPONENT_MAX)
+        begin
+            out <= { valueFloat[SIGN_POS], EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b0 } } };
+        end
+        else
+        begin
+            out <= { valueFloat[SIGN_POS], exponent[0 +: EXPONENT_SIZE], valueFloat[MANTISSA_POS +: MANTISSA_SIZE] };
+        end
+    end
+endmodule
@@ -0,0 +1,123 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Output stationary systolic array with ROWS x COLUMNS FloatGemmPe to calculate C = A * B.
+// The elements accumulate FLOAT_ADD_LATENCY (LANES) independent sums interleaved (see FloatGemmPe).
+// Therefore the array calculates a tile of C with ROWS * LANES rows and COLUMNS columns.
+// The operands are streamed in steps. Step k * LANES + l contains in 'a' the column k of the rows
+// l * ROWS .. (l * ROWS) + ROWS - 1 of A (row l * ROWS in the LSBs) and in 'b' the row k of B.
+// b is the same for all LANES steps of k. 'inFirst' must be set in the steps of k = 0, 'inLast'
+// in the steps of k = K - 1 (both when K = 1). The next tile can directly follow.
+// a is passed from left to right, b from the top to the bottom through the array. The operands
+// are skewed with ValueDelays at the inputs, so that they meet in the right element. The results
+// are deskewed with ValueDelays. 'c' contains the rows l * ROWS .. (l * ROWS) + ROWS - 1 of the
+// tile (element (i, j) at (i * COLUMNS) + j) when 'outValid' is set. The LANES row blocks are
+// streamed out in consecutive clocks.
+// This module is pipelined. It can calculate ROWS * COLUMNS multiply accumulates per clock
+// This module has a latency of ROWS + COLUMNS + 4 + MUL_DELAY clock cycles
+module FloatGemm
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter ROWS = 4,
+    parameter COLUMNS = 4,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LANES = `FLOAT_ADD_LATENCY,
+    localparam LATENCY = `FLOAT_GEMM_LATENCY(ROWS, COLUMNS, MUL_DELAY)
+)
+(
+    input  wire                                         clk,
+    input  wire                                         ce,
+    input  wire                                         inFirst,
+    input  wire                                         inLast,
+    input  wire [(ROWS * FLOAT_SIZE) - 1 : 0]           a,
+    input  wire [(COLUMNS * FLOAT_SIZE) - 1 : 0]        b,
+    output wire [(ROWS * COLUMNS * FLOAT_SIZE) - 1 : 0] c,
+    output wire                                         outValid
+);
+    // Operands and flags at the inputs of the elements. Element (i, j) uses the index (i * (COLUMNS + 1)) + j
+    // for a and the flags, and (i * COLUMNS) + j for b. The additional entries are the outputs of the last
+    // column (a) and the last row (b).
+    wire [(ROWS * (COLUMNS + 1) * FLOAT_SIZE) - 1 : 0]  as;
+    wire [(ROWS * (COLUMNS + 1)) - 1 : 0]               firsts;
+    wire [(ROWS * (COLUMNS + 1)) - 1 : 0]               lasts;
+    wire [((ROWS + 1) * COLUMNS * FLOAT_SIZE) - 1 : 0]  bs;
+
+    generate
+        genvar i;
+        genvar j;
+
+        ////////////////////////////////////////////////////////////////////////////
+        // Skew the operands
+        ////////////////////////////////////////////////////////////////////////////
+        for (i = 0; i < ROWS; i = i + 1)
+        begin : SkewA
+            ValueDelay #(.VALUE_SIZE(2 + FLOAT_SIZE), .DELAY(i)) 
+                aDelay (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .in({ inFirst, inLast, a[i * FLOAT_SIZE +: FLOAT_SIZE] }), 
+                    .out({ firsts[i * (COLUMNS + 1)], lasts[i * (COLUMNS + 1)], as[(i * (COLUMNS + 1)) * FLOAT_SIZE +: FLOAT_SIZE] })
+                );
+        end
+
+        for (j = 0; j < COLUMNS; j = j + 1)
+        begin : SkewB
+            ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(j)) 
+                bDelay (.clk(clk), .ce(ce), .in(b[j * FLOAT_SIZE +: FLOAT_SIZE]), .out(bs[j * FLOAT_SIZE +: FLOAT_SIZE]));
+        end
+
+        ////////////////////////////////////////////////////////////////////////////
+        // Array and deskew of the results
+        ////////////////////////////////////////////////////////////////////////////
+        for (i = 0; i < ROWS; i = i + 1)
+        begin : Row
+            for (j = 0; j < COLUMNS; j = j + 1)
+            begin : Column
+                wire [FLOAT_SIZE - 1 : 0] peC;
+
+                FloatGemmPe #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .MUL_DELAY(MUL_DELAY))
+                    pe (
+                        .clk(clk), 
+                        .ce(ce), 
+
+                        .firstIn(firsts[(i * (COLUMNS + 1)) + j]), 
+                        .lastIn(lasts[(i * (COLUMNS + 1)) + j]), 
+                        .aIn(as[((i * (COLUMNS + 1)) + j) * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .bIn(bs[((i * COLUMNS) + j) * FLOAT_SIZE +: FLOAT_SIZE]), 
+
+                        .firstOut(firsts[(i * (COLUMNS + 1)) + j + 1]), 
+                        .lastOut(lasts[(i * (COLUMNS + 1)) + j + 1]), 
+                        .aOut(as[((i * (COLUMNS + 1)) + j + 1) * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .bOut(bs[(((i + 1) * COLUMNS) + j) * FLOAT_SIZE +: FLOAT_SIZE]), 
+
+                        .c(peC), 
+                        .cLast()
+                    );
+
+                ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY((ROWS - 1 - i) + (COLUMNS - 1 - j))) 
+                    cDelay (.clk(clk), .ce(ce), .in(peC), .out(c[((i * COLUMNS) + j) * FLOAT_SIZE +: FLOAT_SIZE]));
+            end
+        end
+    endgenerate
+
+    ValueDelay #(.VALUE_SIZE(1), .DELAY(LATENCY)) 
+        validDelay (.clk(clk), .ce(ce), .in(inLast), .out(outValid));
+endmodule
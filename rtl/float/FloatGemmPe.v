@@ -0,0 +1,90 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Processing element of the FloatGemm. It multiplies a and b and accumulates the products.
+// The FloatAdd of the accumulator has a latency of FLOAT_ADD_LATENCY clocks. To hide this
+// latency, the accumulator interleaves FLOAT_ADD_LATENCY independent sums (lanes). The lane
+// is selected by the clock: The sum of the product in clock t is fed back to the product
+// in clock t + FLOAT_ADD_LATENCY. 'first' starts a new sum in the lane of the current
+// product, 'last' marks the last product of the sum. The sum is in 'c' when 'cLast' is set.
+// a, b and the flags are forwarded to the neighbouring elements with one register.
+// This module is pipelined. It can calculate one multiply accumulate per clock
+// This module has a latency of 6 + MUL_DELAY clock cycles (from a to c)
+module FloatGemmPe
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_MUL_LATENCY(MUL_DELAY) + `FLOAT_ADD_LATENCY
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+
+    input  wire                         firstIn,
+    input  wire                         lastIn,
+    input  wire [FLOAT_SIZE - 1 : 0]    aIn,
+    input  wire [FLOAT_SIZE - 1 : 0]    bIn,
+
+    output reg                          firstOut,
+    output reg                          lastOut,
+    output reg  [FLOAT_SIZE - 1 : 0]    aOut,
+    output reg  [FLOAT_SIZE - 1 : 0]    bOut,
+
+    output wire [FLOAT_SIZE - 1 : 0]    c,
+    output wire                         cLast
+);
+    localparam MUL_LATENCY = `FLOAT_MUL_LATENCY(MUL_DELAY);
+
+    always @(posedge clk)
+    if (ce) begin : Forward
+        firstOut <= firstIn;
+        lastOut <= lastIn;
+        aOut <= aIn;
+        bOut <= bIn;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Multiplication
+    // Clocks: FLOAT_MUL_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]   prod;
+    wire                        prodFirst;
+    wire                        prodLast;
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+        mul (.clk(clk), .ce(ce), .facAIn(aIn), .facBIn(bIn), .prod(prod));
+
+    ValueDelay #(.VALUE_SIZE(2), .DELAY(MUL_LATENCY)) 
+        flagDelay (.clk(clk), .ce(ce), .in({ firstIn, lastIn }), .out({ prodFirst, prodLast }));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Accumulation. The sum of the lane leaves the adder when the next product
+    // of the lane enters it.
+    // Clocks: FLOAT_ADD_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        accumulator (.clk(clk), .ce(ce), .aIn(prod), .bIn((prodFirst) ? { FLOAT_SIZE { 1'b0 } } : c), .sum(c));
+
+    ValueDelay #(.VALUE_SIZE(1), .DELAY(`FLOAT_ADD_LATENCY)) 
+        lastDelay (.clk(clk), .ce(ce), .in(prodLast), .out(cLast));
+endmodule
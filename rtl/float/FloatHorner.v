@@ -0,0 +1,124 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Evaluates the polynomial c[DEGREE] * x ** DEGREE + ... + c[1] * x + c[0] in Horner form:
+// acc = (acc * x) + c[j]
+// The Horner steps are unrolled. Every step uses a FloatMulUnpacked and a FloatAddUnpacked,
+// so that the intermediate results are not packed and rounded (see FloatUnpack). x is delayed
+// to the next step with a ValueDelay.
+// COEFFICIENTS contains the DEGREE + 1 coefficients as floats, c[0] in the LSBs. The default
+// is the second Newton-Raphson iteration of the reciprocal: 4 - 6 * w + 4 * w ** 2 - w ** 3
+// This module is pipelined. It can evaluate one polynomial per clock
+// This module has a latency of 2 + DEGREE * (4 + MUL_DELAY) clock cycles
+module FloatHorner
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    parameter DEGREE = 3,
+    parameter [((DEGREE + 1) * (1 + EXPONENT_SIZE + MANTISSA_SIZE)) - 1 : 0] COEFFICIENTS = { 32'hbf800000, 32'h40800000, 32'hc0c00000, 32'h40800000 },
+    parameter MUL_DELAY = 0, // DELAY of the FloatMulUnpacked
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam UNPACKED_SIZE = 1 + (EXPONENT_SIZE + 2) + (2 + MANTISSA_SIZE + GUARD_SIZE),
+    localparam LATENCY = `FLOAT_HORNER_LATENCY(DEGREE, MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    x,
+    output wire [FLOAT_SIZE - 1 : 0]    y
+);
+    localparam STEP_LATENCY = `FLOAT_MUL_UNPACKED_LATENCY(MUL_DELAY) + `FLOAT_ADD_UNPACKED_LATENCY;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Unpack x and the coefficients
+    // Clocks: FLOAT_UNPACK_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [((DEGREE + 1) * UNPACKED_SIZE) - 1 : 0]   coefficients;
+    wire [((DEGREE + 1) * UNPACKED_SIZE) - 1 : 0]   xs;
+    wire [((DEGREE + 1) * UNPACKED_SIZE) - 1 : 0]   accs;
+
+    FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        xUnpack (.clk(clk), .ce(ce), .in(x), .out(xs[0 +: UNPACKED_SIZE]));
+
+    generate
+        genvar j;
+        for (j = 0; j <= DEGREE; j = j + 1)
+        begin : Coefficient
+            // The coefficients are constant, the synthesis removes the unpacking
+            FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+                coefficientUnpack (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .in(COEFFICIENTS[j * FLOAT_SIZE +: FLOAT_SIZE]), 
+                    .out(coefficients[j * UNPACKED_SIZE +: UNPACKED_SIZE])
+                );
+        end
+    endgenerate
+
+    assign accs[0 +: UNPACKED_SIZE] = coefficients[DEGREE * UNPACKED_SIZE +: UNPACKED_SIZE];
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Horner: acc = (acc * x) + c[j]
+    // Clocks: DEGREE * STEP_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    generate
+        genvar k;
+        for (k = 0; k < DEGREE; k = k + 1)
+        begin : Horner
+            wire [UNPACKED_SIZE - 1 : 0] prod;
+
+            FloatMulUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE), .DELAY(MUL_DELAY))
+                mul (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .facAIn(accs[k * UNPACKED_SIZE +: UNPACKED_SIZE]), 
+                    .facBIn(xs[k * UNPACKED_SIZE +: UNPACKED_SIZE]), 
+                    .prod(prod)
+                );
+
+            FloatAddUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+                add (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .aIn(prod), 
+                    .bIn(coefficients[(DEGREE - 1 - k) * UNPACKED_SIZE +: UNPACKED_SIZE]), 
+                    .sum(accs[(k + 1) * UNPACKED_SIZE +: UNPACKED_SIZE])
+                );
+
+            ValueDelay #(.VALUE_SIZE(UNPACKED_SIZE), .DELAY(STEP_LATENCY)) 
+                xDelay (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .in(xs[k * UNPACKED_SIZE +: UNPACKED_SIZE]), 
+                    .out(xs[(k + 1) * UNPACKED_SIZE +: UNPACKED_SIZE])
+                );
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Pack the result
+    // Clocks: FLOAT_PACK_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    FloatPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        yPack (.clk(clk), .ce(ce), .in(accs[DEGREE * UNPACKED_SIZE +: UNPACKED_SIZE]), .out(y));
+endmodule
@@ -0,0 +1,235 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Perspective correct interpolation of ATTRIBUTES attributes across a triangle.
+// Every attribute k is interpolated as plane p = a + b * x + c * y of attribute / w. Additionally the
+// plane of 1 / w is interpolated. Per pixel, w is calculated with one FloatRecip which is shared by all
+// attributes, and the attributes are multiplied with w.
+// The planes are evaluated incrementally with one FloatAdd per plane and pixel. The pixels of a triangle
+// are walked row by row from left to right, a pixel per clock (for instance the bounding box).
+// 'inFirst' marks the first pixel of a triangle, its position is the origin of the planes (a is the
+// value at the first pixel). 'inNewRow' marks the first pixel of the next row, which is below the first
+// pixel of the previous row. Every other clock with ce is the pixel right of the previous pixel.
+// Because the FloatAdd has a latency of FLOAT_ADD_LATENCY clocks, a pixel can't use the value of its left
+// neighbour. The row is split into FLOAT_ADD_LATENCY interleaved lanes instead: the first four pixels of
+// a row are calculated with row + { 0, 1, 2, 3 } * b, every following pixel with p(x - 4) + 4 * b.
+// The lanes are implemented for a FLOAT_ADD_LATENCY of 4. The elaboration fails for other latencies.
+// The start of the next row (row + c) is calculated with a second FloatAdd at the begin of a row.
+// Therefore a row must have at least FLOAT_ADD_LATENCY pixels.
+// The planes are written with 'setupWe'. 'setupAddr' 0 is the plane of 1 / w, 'setupAddr' k + 1 the plane
+// of attribute k. 2 * b and 4 * b are calculated by incrementing the exponent of b, 3 * b is calculated
+// with a FloatAdd. Because of that, the first pixel can be issued FLOAT_ADD_LATENCY clocks after the
+// last write. The setup of a triangle can be written after the last pixel of the previous triangle was
+// issued.
+// 'inTag' is delayed with the pixel, so that it is aligned to the attributes (for instance a valid bit
+// and the position of the pixel).
+// outAttributes contains the attributes, attribute 0 in the LSBs. outW contains w.
+// This module is pipelined. It can interpolate one pixel per clock
+// This module has a latency of 4 + 11 + 2 + MUL_DELAY clock cycles
+module FloatInterpolator
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter ATTRIBUTES = 4,
+    parameter TAG_SIZE = 1,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam PLANES = ATTRIBUTES + 1,
+    localparam PLANE_ADDR_SIZE = $clog2(PLANES),
+    localparam LATENCY = `FLOAT_INTERPOLATOR_LATENCY(MUL_DELAY)
+)
+(
+    input  wire                                     clk,
+    input  wire                                     ce,
+
+    input  wire                                     setupWe,
+    input  wire [PLANE_ADDR_SIZE - 1 : 0]           setupAddr,
+    input  wire [FLOAT_SIZE - 1 : 0]                setupA,
+    input  wire [FLOAT_SIZE - 1 : 0]                setupB,
+    input  wire [FLOAT_SIZE - 1 : 0]                setupC,
+
+    input  wire                                     inFirst,
+    input  wire                                     inNewRow,
+    input  wire [TAG_SIZE - 1 : 0]                  inTag,
+
+    output wire [(ATTRIBUTES * FLOAT_SIZE) - 1 : 0] outAttributes,
+    output wire [FLOAT_SIZE - 1 : 0]                outW,
+    output wire [TAG_SIZE - 1 : 0]                  outTag
+);
+    localparam ADD_LATENCY = `FLOAT_ADD_LATENCY;
+    localparam MUL_LATENCY = `FLOAT_MUL_LATENCY(MUL_DELAY);
+    localparam RECIP_LATENCY = `FLOAT_RECIP_LATENCY(2);
+    localparam [FLOAT_SIZE - 1 : 0] ZERO = 0;
+
+    // Multiplies the value with 2 ** n. Zero stays zero, an overflow of the exponent is not handled.
+    function [FLOAT_SIZE - 1 : 0] scale;
+        input [FLOAT_SIZE - 1 : 0]  value;
+        input [1 : 0]               n;
+        begin
+            scale = value;
+            if (value[MANTISSA_SIZE +: EXPONENT_SIZE] != 0)
+            begin
+                scale[MANTISSA_SIZE +: EXPONENT_SIZE] = value[MANTISSA_SIZE +: EXPONENT_SIZE] + { { (EXPONENT_SIZE - 2) { 1'b0 } }, n };
+            end
+        end
+    endfunction
+
+    generate
+        if (ADD_LATENCY != 4)
+        begin : CheckAddLatency
+            // The lanes of the plane evaluation (xCount, step and b3) are built for four lanes.
+            // This module doesn't exist, so that the elaboration fails.
+            FloatInterpolator_requires_a_FLOAT_ADD_LATENCY_of_4 error ();
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Setup
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [(PLANES * FLOAT_SIZE) - 1 : 0]    planeA = 0;
+    reg  [(PLANES * FLOAT_SIZE) - 1 : 0]    planeB = 0;
+    reg  [(PLANES * FLOAT_SIZE) - 1 : 0]    planeC = 0;
+    reg  [(PLANES * FLOAT_SIZE) - 1 : 0]    planeB3 = 0;
+    wire [FLOAT_SIZE - 1 : 0]               setupB3;
+    wire                                    setupB3We;
+    wire [PLANE_ADDR_SIZE - 1 : 0]          setupB3Addr;
+
+    FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        setupAdd (.clk(clk), .ce(1'b1), .aIn(setupB), .bIn(scale(setupB, 2'd1)), .sum(setupB3));
+
+    ValueDelay #(.VALUE_SIZE(1 + PLANE_ADDR_SIZE), .DELAY(ADD_LATENCY)) 
+        setupDelay (.clk(clk), .ce(1'b1), .in({ setupWe, setupAddr }), .out({ setupB3We, setupB3Addr }));
+
+    always @(posedge clk)
+    begin
+        if (setupWe)
+        begin
+            planeA[setupAddr * FLOAT_SIZE +: FLOAT_SIZE] <= setupA;
+            planeB[setupAddr * FLOAT_SIZE +: FLOAT_SIZE] <= setupB;
+            planeC[setupAddr * FLOAT_SIZE +: FLOAT_SIZE] <= setupC;
+        end
+        if (setupB3We)
+        begin
+            planeB3[setupB3Addr * FLOAT_SIZE +: FLOAT_SIZE] <= setupB3;
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Evaluate the planes
+    // Clocks: FLOAT_ADD_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire                                    rowBegin = inFirst || inNewRow;
+    wire                                    rowDone;
+    reg  [2 : 0]                            xCount = 0; // Saturates at 4
+    wire [2 : 0]                            x = (rowBegin) ? 3'd0 : xCount;
+    wire [(PLANES * FLOAT_SIZE) - 1 : 0]    planes;
+
+    always @(posedge clk)
+    if (ce) begin
+        xCount <= (x == 4) ? x : x + 1;
+    end
+
+    ValueDelay #(.VALUE_SIZE(1), .DELAY(ADD_LATENCY)) 
+        rowDelay (.clk(clk), .ce(ce), .in(rowBegin), .out(rowDone));
+
+    generate
+        genvar p;
+        for (p = 0; p < PLANES; p = p + 1)
+        begin : Plane
+            wire [FLOAT_SIZE - 1 : 0]   a = planeA[p * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   b = planeB[p * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   c = planeC[p * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   b3 = planeB3[p * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   rowSum;
+            wire [FLOAT_SIZE - 1 : 0]   sum = planes[p * FLOAT_SIZE +: FLOAT_SIZE];
+            reg  [FLOAT_SIZE - 1 : 0]   row = 0;
+            reg  [FLOAT_SIZE - 1 : 0]   nextRowReg = 0;
+            wire [FLOAT_SIZE - 1 : 0]   nextRow = (rowDone) ? rowSum : nextRowReg;
+            wire [FLOAT_SIZE - 1 : 0]   rowNow = (inFirst) ? a : (inNewRow) ? nextRow : row;
+            reg  [FLOAT_SIZE - 1 : 0]   step;
+
+            always @(*)
+            begin
+                case (x)
+                    0: step = ZERO;
+                    1: step = b;
+                    2: step = scale(b, 2'd1);
+                    3: step = b3;
+                    default: step = scale(b, 2'd2);
+                endcase
+            end
+
+            always @(posedge clk)
+            if (ce) begin
+                row <= rowNow;
+                if (rowDone)
+                begin
+                    nextRowReg <= rowSum;
+                end
+            end
+
+            FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                rowAdd (.clk(clk), .ce(ce), .aIn(rowNow), .bIn(c), .sum(rowSum));
+
+            FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                pixelAdd (.clk(clk), .ce(ce), .aIn((x == 4) ? sum : rowNow), .bIn(step), .sum(planes[p * FLOAT_SIZE +: FLOAT_SIZE]));
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Calculate w
+    // Clocks: FLOAT_RECIP_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]               w;
+    wire [(ATTRIBUTES * FLOAT_SIZE) - 1 : 0] attributes;
+
+    FloatRecip #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        wRecip (.clk(clk), .ce(ce), .in(planes[0 +: FLOAT_SIZE]), .out(w));
+
+    ValueDelay #(.VALUE_SIZE(ATTRIBUTES * FLOAT_SIZE), .DELAY(RECIP_LATENCY)) 
+        attributeDelay (.clk(clk), .ce(ce), .in(planes[FLOAT_SIZE +: ATTRIBUTES * FLOAT_SIZE]), .out(attributes));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Multiply the attributes with w
+    // Clocks: FLOAT_MUL_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    generate
+        genvar k;
+        for (k = 0; k < ATTRIBUTES; k = k + 1)
+        begin : Attribute
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                mul (
+                    .clk(clk), 
+                    .ce(ce), 
+                    .facAIn(attributes[k * FLOAT_SIZE +: FLOAT_SIZE]), 
+                    .facBIn(w), 
+                    .prod(outAttributes[k * FLOAT_SIZE +: FLOAT_SIZE])
+                );
+        end
+    endgenerate
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(MUL_LATENCY)) 
+        wDelay (.clk(clk), .ce(ce), .in(w), .out(outW));
+
+    ValueDelay #(.VALUE_SIZE(TAG_SIZE), .DELAY(LATENCY)) 
+        tagDelay (.clk(clk), .ce(ce), .in(inTag), .out(outTag));
+endmodule
@@ -0,0 +1,75 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Latencies (in clock cycles) of the modules in this library.
+// Every module exports its latency as LATENCY localparam which is derived from
+// the macros in this file. Modules which are build out of other modules should
+// also use these macros to calculate delays. Then a change of a latency (for
+// instance by changing the DELAY of a FloatMul) is automatically propagated
+// to all datapaths which are using this module.
+`ifndef FLOAT_LATENCY_VH
+`define FLOAT_LATENCY_VH
+
+`define VALUE_DELAY_LATENCY(DELAY) (((DELAY) > 0) ? (DELAY) : 0)
+`define FLOAT_ADD_ALIGN_LATENCY 1
+`define FLOAT_ADD_NORMALIZE_LATENCY 3
+`define FLOAT_ADD_LATENCY (`FLOAT_ADD_ALIGN_LATENCY + `FLOAT_ADD_NORMALIZE_LATENCY)
+`define FLOAT_SUB_LATENCY `FLOAT_ADD_LATENCY
+`define FLOAT_ADD_SUB_LATENCY `FLOAT_ADD_LATENCY
+`define FLOAT_ADD3_LATENCY 4
+`define FLOAT_COMPARE_LATENCY 1
+`define FIXED_FUNCTION_LATENCY(DEGREE) (1 + (DEGREE))
+`define FLOAT_EXP2_LATENCY(DEGREE) (2 + `FIXED_FUNCTION_LATENCY(DEGREE))
+`define FLOAT_LOG2_LATENCY(DEGREE) (3 + `FIXED_FUNCTION_LATENCY(DEGREE))
+`define FLOAT_SIN_COS_LATENCY(DEGREE) (2 + `FIXED_FUNCTION_LATENCY(DEGREE) + 1 + `INT_TO_FLOAT_LATENCY + 1)
+`define FLOAT_CORDIC_LATENCY(ITERATIONS) (1 + `FLOAT_TO_INT_LATENCY(0) + 1 + (ITERATIONS) + 1 + `INT_TO_FLOAT_LATENCY + 1)
+`define FLOAT_FUNCTION_LATENCY(DEGREE) (1 + `FIXED_FUNCTION_LATENCY(DEGREE) + `INT_TO_FLOAT_LATENCY + 1)
+`define FLOAT_MUL_LATENCY(DELAY) (2 + (DELAY))
+`define FLOAT_MUL_CONST_LATENCY(DELAY) (3 + (DELAY))
+`define FLOAT_SQUARE_LATENCY(DELAY) (3 + (DELAY))
+`define DOUBLE_PUMPED_MUL_LATENCY 3
+`define FLOAT_MUL_DOUBLE_PUMPED_LATENCY(DELAY) (`DOUBLE_PUMPED_MUL_LATENCY + 1 + (DELAY))
+`define FLOAT_COMPLEX_MUL_LATENCY(DELAY) (`FLOAT_ADD_LATENCY + `FLOAT_MUL_LATENCY(DELAY) + `FLOAT_ADD_LATENCY)
+`define FLOAT_FFT_BUTTERFLY_LATENCY(DELAY) ((DELAY) + `FLOAT_ADD_SUB_LATENCY + 1)
+`define FLOAT_FFT_TWIDDLE_LATENCY(MUL_DELAY) (1 + `FLOAT_COMPLEX_MUL_LATENCY(MUL_DELAY) + 1)
+`define FLOAT_FFT_LATENCY(SIZE_LOG2, MUL_DELAY) (((1 << (SIZE_LOG2)) - 1) + ((SIZE_LOG2) * (`FLOAT_ADD_SUB_LATENCY + 1)) + (((SIZE_LOG2) - 1) * `FLOAT_FFT_TWIDDLE_LATENCY(MUL_DELAY)))
+`define FLOAT_GEMM_LATENCY(ROWS, COLUMNS, DELAY) (((ROWS) - 1) + ((COLUMNS) - 1) + `FLOAT_MUL_LATENCY(DELAY) + `FLOAT_ADD_LATENCY)
+`define FLOAT_FIR_MULTIPLIERS(TAPS, SYMMETRIC) ((SYMMETRIC) ? (((TAPS) + 1) / 2) : (TAPS))
+`define FLOAT_FIR_LATENCY(TAPS, SYMMETRIC, DELAY) ((`FLOAT_FIR_MULTIPLIERS(TAPS, SYMMETRIC) * (`FLOAT_ADD_LATENCY - 1)) + 1 + `FLOAT_MUL_LATENCY(DELAY) + ((SYMMETRIC) ? `FLOAT_ADD_LATENCY : 0))
+`define FLOAT_BIQUAD_LOOP_LATENCY(DELAY) (`FLOAT_MUL_LATENCY(DELAY) + `FLOAT_ADD3_LATENCY)
+`define FLOAT_BIQUAD_LATENCY(SECTIONS, DELAY) ((SECTIONS) * (`FLOAT_MUL_LATENCY(DELAY) + (2 * `FLOAT_ADD3_LATENCY)))
+`define FLOAT_TO_INT_LATENCY(DELAY) (2 + (DELAY))
+`define INT_TO_FLOAT_LATENCY 4
+`define FLOAT_UNPACK_LATENCY 1
+`define FLOAT_PACK_LATENCY 1
+`define FLOAT_MUL_UNPACKED_LATENCY(DELAY) (1 + (DELAY))
+`define FLOAT_ADD_UNPACKED_LATENCY 3
+`define FLOAT_SUB_UNPACKED_LATENCY `FLOAT_ADD_UNPACKED_LATENCY
+`define FLOAT_HORNER_LATENCY(DEGREE, DELAY) (`FLOAT_UNPACK_LATENCY + ((DEGREE) * (`FLOAT_MUL_UNPACKED_LATENCY(DELAY) + `FLOAT_ADD_UNPACKED_LATENCY)) + `FLOAT_PACK_LATENCY)
+`define FLOAT_LERP_LATENCY(DELAY) (`FLOAT_UNPACK_LATENCY + `FLOAT_SUB_UNPACKED_LATENCY + `FLOAT_MUL_UNPACKED_LATENCY(DELAY) + `FLOAT_ADD_UNPACKED_LATENCY + `FLOAT_PACK_LATENCY)
+`define FLOAT_BILINEAR_LATENCY(DELAY) (`INT_TO_FLOAT_LATENCY + (2 * `FLOAT_LERP_LATENCY(DELAY)))
+`define NEWTON_RAPHSON_ITERATION_INIT_LATENCY 4
+`define NEWTON_RAPHSON_ITERATION_LATENCY 3
+`define COMPUTE_RECIP_LATENCY(ITR) (`NEWTON_RAPHSON_ITERATION_INIT_LATENCY + ((ITR) * `NEWTON_RAPHSON_ITERATION_LATENCY))
+`define FLOAT_RECIP_LATENCY(ITR) (`COMPUTE_RECIP_LATENCY(ITR) + 1)
+`define FLOAT_FAST_RECIP_LATENCY (1 + `FLOAT_MUL_LATENCY(1)) // Same latency with FLOAT_SQUARE_LATENCY(0)
+`define FLOAT_VERTEX_TRANSFORM_LATENCY(DELAY) ((2 * `FLOAT_MUL_LATENCY(DELAY)) + (2 * `FLOAT_ADD_LATENCY) + `FLOAT_RECIP_LATENCY(2))
+`define FLOAT_INTERPOLATOR_LATENCY(DELAY) (`FLOAT_ADD_LATENCY + `FLOAT_RECIP_LATENCY(2) + `FLOAT_MUL_LATENCY(DELAY))
+`define FLOAT_RASTERIZER_SETUP_LATENCY(DELAY) (`FLOAT_MUL_LATENCY(DELAY) + `FLOAT_SUB_LATENCY + `FLOAT_TO_INT_LATENCY(0) + 1)
+`define XRECIP_LATENCY(ITERATIONS) (2 + `COMPUTE_RECIP_LATENCY(ITERATIONS) + 1)
+
+`endif // FLOAT_LATENCY_VH
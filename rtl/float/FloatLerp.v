@@ -0,0 +1,112 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Linear interpolation a + t * (b - a)
+// The difference, the product and the sum are calculated with a FloatSubUnpacked, a FloatMulUnpacked
+// and a FloatAddUnpacked. The intermediate results are not packed, so the normalization of the
+// difference and the product is fused into the following operation and the result is only rounded
+// once by the FloatPack (see FloatUnpack). t and a are delayed in the unpacked format with ValueDelays.
+// With t = 0 the result is exactly a.
+// This module is pipelined. It can calculate one interpolation per clock
+// This module has a latency of 1 + 3 + 1 + MUL_DELAY + 3 + 1 clock cycles
+module FloatLerp
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    parameter MUL_DELAY = 0, // DELAY of the FloatMulUnpacked
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam UNPACKED_SIZE = 1 + (EXPONENT_SIZE + 2) + (2 + MANTISSA_SIZE + GUARD_SIZE),
+    localparam LATENCY = `FLOAT_LERP_LATENCY(MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    a,
+    input  wire [FLOAT_SIZE - 1 : 0]    b,
+    input  wire [FLOAT_SIZE - 1 : 0]    t,
+    output wire [FLOAT_SIZE - 1 : 0]    out
+);
+    localparam SUB_LATENCY = `FLOAT_SUB_UNPACKED_LATENCY;
+    localparam MUL_LATENCY = `FLOAT_MUL_UNPACKED_LATENCY(MUL_DELAY);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Unpack the operands
+    // Clocks: FLOAT_UNPACK_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [UNPACKED_SIZE - 1 : 0]    aUnpacked;
+    wire [UNPACKED_SIZE - 1 : 0]    bUnpacked;
+    wire [UNPACKED_SIZE - 1 : 0]    tUnpacked;
+
+    FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        aUnpack (.clk(clk), .ce(ce), .in(a), .out(aUnpacked));
+
+    FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        bUnpack (.clk(clk), .ce(ce), .in(b), .out(bUnpacked));
+
+    FloatUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        tUnpack (.clk(clk), .ce(ce), .in(t), .out(tUnpacked));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Difference b - a
+    // Clocks: FLOAT_SUB_UNPACKED_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [UNPACKED_SIZE - 1 : 0]    diff;
+    wire [UNPACKED_SIZE - 1 : 0]    tDelayed;
+
+    FloatSubUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        sub (.clk(clk), .ce(ce), .aIn(bUnpacked), .bIn(aUnpacked), .sum(diff));
+
+    ValueDelay #(.VALUE_SIZE(UNPACKED_SIZE), .DELAY(SUB_LATENCY)) 
+        tDelay (.clk(clk), .ce(ce), .in(tUnpacked), .out(tDelayed));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Product t * (b - a)
+    // Clocks: FLOAT_MUL_UNPACKED_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [UNPACKED_SIZE - 1 : 0]    prod;
+    wire [UNPACKED_SIZE - 1 : 0]    aDelayed;
+
+    FloatMulUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE), .DELAY(MUL_DELAY))
+        mul (.clk(clk), .ce(ce), .facAIn(tDelayed), .facBIn(diff), .prod(prod));
+
+    ValueDelay #(.VALUE_SIZE(UNPACKED_SIZE), .DELAY(SUB_LATENCY + MUL_LATENCY)) 
+        aDelay (.clk(clk), .ce(ce), .in(aUnpacked), .out(aDelayed));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Sum a + t * (b - a)
+    // Clocks: FLOAT_ADD_UNPACKED_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [UNPACKED_SIZE - 1 : 0]    sum;
+
+    FloatAddUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        add (.clk(clk), .ce(ce), .aIn(aDelayed), .bIn(prod), .sum(sum));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 4
+    // Pack the result
+    // Clocks: FLOAT_PACK_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    FloatPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE))
+        outPack (.clk(clk), .ce(ce), .in(sum), .out(out));
+endmodule
@@ -0,0 +1,207 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point log2(x)
+// x is split into its exponent and its mantissa. The exponent is the integer part of the
+// result. log2(1.0 + mantissa) is calculated with the FixedFunction which uses a table of
+// polynomials. TABLE_SIZE_LOG2 and DEGREE configure the accuracy (see FixedFunction).
+// GUARD_SIZE is the number of additional fraction bits of the fixed point calculation.
+// Because the result is calculated in fixed point, the error of results in the range of
+// -1.0 .. 1.0 is an absolute error of roughly 2 ** -(MANTISSA_SIZE + 1). For other results,
+// the measured error for a float (s=1, e=8, m=23) is:
+//  - TABLE_SIZE_LOG2 = 8, DEGREE = 2: < 0.7 ulp
+//  - TABLE_SIZE_LOG2 = 6, DEGREE = 3: < 0.6 ulp
+// Denormalized numbers are handled like zero. log2(0) is -Inf, log2 of a negative number
+// is NaN, log2(Inf) is Inf and log2(NaN) is NaN. Results which would be denormalized
+// numbers are flushed to zero.
+// This module is pipelined. It can calculate one log2(x) per clock
+// This module has a latency of DEGREE + 4 clock cycles
+module FloatLog2
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter TABLE_SIZE_LOG2 = 8,
+    parameter DEGREE = 2,
+    parameter GUARD_SIZE = 6,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_LOG2_LATENCY(DEGREE)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    in,
+    output reg  [FLOAT_SIZE - 1 : 0]    out
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam EXPONENT_MAX = (2 ** EXPONENT_SIZE) - 1; // Inf and NaN
+
+    localparam FRACTION_SIZE = MANTISSA_SIZE + GUARD_SIZE;
+    localparam VALUE_SIZE = FRACTION_SIZE + 3; // See FixedFunction
+    localparam SUM_SIZE = EXPONENT_SIZE + FRACTION_SIZE; // Unsigned result in fixed point
+    localparam SUM_CALC_SIZE = SUM_SIZE + 1; // Add sign
+    localparam SUM_TOP_POS = SUM_SIZE - 1;
+    localparam LEADING_ONE_SIZE = $clog2(SUM_SIZE) + 1;
+    localparam LEADING_ONE_INVALID_VALUE = (2 ** LEADING_ONE_SIZE) - 1;
+    localparam EXPONENT_CALC_SIZE = (LEADING_ONE_SIZE > EXPONENT_SIZE) ? LEADING_ONE_SIZE + 2 : EXPONENT_SIZE + 2;
+    localparam PACKED_SIZE = EXPONENT_CALC_SIZE + MANTISSA_SIZE;
+    localparam FLAGS_SIZE = EXPONENT_SIZE + 4;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Calculate log2(1.0 + mantissa)
+    // Clocks: FIXED_FUNCTION_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [VALUE_SIZE - 1 : 0]       logMantissa;
+    wire [EXPONENT_SIZE - 1 : 0]    exponentDelayed;
+    wire                            zeroDelayed;
+    wire                            negativeDelayed;
+    wire                            infDelayed;
+    wire                            nanDelayed;
+
+    FixedFunction #(
+        .FUNCTION("LOG2"),
+        .X_SIZE(MANTISSA_SIZE),
+        .TABLE_SIZE_LOG2(TABLE_SIZE_LOG2),
+        .DEGREE(DEGREE),
+        .FRACTION_SIZE(FRACTION_SIZE)
+    ) log2 (
+        .clk(clk),
+        .ce(ce),
+        .x(in[MANTISSA_POS +: MANTISSA_SIZE]),
+        .y(logMantissa)
+    );
+
+    ValueDelay #(.VALUE_SIZE(FLAGS_SIZE), .DELAY(`FIXED_FUNCTION_LATENCY(DEGREE))) 
+        flagsDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ 
+                in[EXPONENT_POS +: EXPONENT_SIZE],
+                in[EXPONENT_POS +: EXPONENT_SIZE] == 0,
+                in[SIGN_POS],
+                (in[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]) && (in[MANTISSA_POS +: MANTISSA_SIZE] == 0),
+                (in[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]) && (in[MANTISSA_POS +: MANTISSA_SIZE] != 0)
+            }), 
+            .out({ exponentDelayed, zeroDelayed, negativeDelayed, infDelayed, nanDelayed })
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Add the exponent as integer part
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                             one_sign;
+    reg  [SUM_SIZE - 1 : 0]         one_sum;
+    reg  [FLOAT_SIZE - 1 : 0]       one_special;
+    reg                             one_isSpecial;
+    always @(posedge clk)
+    if (ce) begin : Combine
+        reg  [SUM_CALC_SIZE - 1 : 0]    sum;
+
+        sum = ({ 1'b0, exponentDelayed, { FRACTION_SIZE { 1'b0 } } } - { 1'b0, EXPONENT_BIAS[0 +: EXPONENT_SIZE], { FRACTION_SIZE { 1'b0 } } })
+            + { { (SUM_CALC_SIZE - VALUE_SIZE) { logMantissa[VALUE_SIZE - 1] } }, logMantissa };
+
+        // Convert the signed sum into an unsigned number
+        one_sign <= sum[SUM_CALC_SIZE - 1];
+        if (sum[SUM_CALC_SIZE - 1])
+        begin
+            sum = ~sum + 1;
+        end
+        one_sum <= sum[0 +: SUM_SIZE];
+
+        one_isSpecial <= 1;
+        if (nanDelayed || (negativeDelayed && !zeroDelayed))
+        begin
+            one_special <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+        end
+        else if (zeroDelayed)
+        begin
+            one_special <= { 1'b1, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b0 } } };
+        end
+        else if (infDelayed)
+        begin
+            one_special <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b0 } } };
+        end
+        else
+        begin
+            one_isSpecial <= 0;
+            one_special <= 0;
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Find the leading one
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [LEADING_ONE_SIZE - 1 : 0] leadingOne;
+    FindExponent #(.EXPONENT_SIZE(LEADING_ONE_SIZE), .VALUE_SIZE(SUM_SIZE)) findExponent (one_sum, leadingOne);
+
+    reg                             two_sign;
+    reg  [SUM_SIZE - 1 : 0]         two_sum;
+    reg  [LEADING_ONE_SIZE - 1 : 0] two_leadingOne;
+    reg  [FLOAT_SIZE - 1 : 0]       two_special;
+    reg                             two_isSpecial;
+    always @(posedge clk)
+    if (ce) begin
+        two_sign <= one_sign;
+        two_sum <= one_sum;
+        two_leadingOne <= leadingOne;
+        two_special <= one_special;
+        two_isSpecial <= one_isSpecial;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Normalize, round and pack the result
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    always @(posedge clk)
+    if (ce) begin : Pack
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] exponent;
+        reg        [SUM_SIZE - 1 : 0]           mantissa;
+        reg        [PACKED_SIZE - 1 : 0]        packed;
+
+        // Shift the leading one to the MSB of the mantissa
+        mantissa = two_sum << (SUM_TOP_POS[0 +: LEADING_ONE_SIZE] - two_leadingOne);
+        exponent = $signed({ { (EXPONENT_CALC_SIZE - LEADING_ONE_SIZE) { 1'b0 } }, two_leadingOne }) 
+            + $signed(EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE]) 
+            - $signed(FRACTION_SIZE[0 +: EXPONENT_CALC_SIZE]);
+
+        // Round to nearest. An overflow of the mantissa increments the exponent.
+        packed = { exponent, mantissa[SUM_TOP_POS - 1 -: MANTISSA_SIZE] } 
+            + { { (PACKED_SIZE - 1) { 1'b0 } }, mantissa[SUM_TOP_POS - 1 - MANTISSA_SIZE] };
+
+        if (two_isSpecial)
+        begin
+            out <= two_special;
+        end
+        else if ((two_leadingOne == LEADING_ONE_INVALID_VALUE[0 +: LEADING_ONE_SIZE]) || (exponent <= 0))
+        begin
+            out <= 0;
+        end
+        else
+        begin
+            out <= { two_sign, packed[MANTISSA_SIZE +: EXPONENT_SIZE], packed[0 +: MANTISSA_SIZE] };
+        end
+    end
+endmodule
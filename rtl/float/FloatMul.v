@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Floating point multiplication
 // This module is pipelined. It can calculate one multiplication per clock
 // This module has a latency of 2 clock cycles minimum
@@ -23,7 +25,8 @@ module FloatMul
     parameter MANTISSA_SIZE = 23,
     parameter EXPONENT_SIZE = 8,
     parameter DELAY = 2, // Use this delay to add clock cycles. It adds by default 2 clock cycles, so that the multiplier requieres 4 clocks.
-    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_MUL_LATENCY(DELAY)
 )
 (
     input  wire                      clk,
@@ -32,38 +35,121 @@ module FloatMul
     input  wire [FLOAT_SIZE - 1 : 0] facBIn,
     output wire [FLOAT_SIZE - 1 : 0] prod
 );
-    localparam MANTISSA_POS = 0;
-    localparam EXPONENT_POS = MANTISSA_SIZE;
-    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
-
-    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
-    localparam EXPONENT_INF = (2 ** EXPONENT_SIZE) - 1;
-
     localparam MANTISSA_CALC_SIZE = MANTISSA_SIZE + 1; // Add hidden bit
     localparam MANTISSA_PROD_SIZE = MANTISSA_CALC_SIZE * 2;
-    localparam EXPONENT_SUM_ADDITIONAL_BITS = 1 + 1; // Add one bit for sign and one for overflow
-    localparam EXPONENT_SUM_SIZE = EXPONENT_SIZE + EXPONENT_SUM_ADDITIONAL_BITS; 
 
-    reg  [FLOAT_SIZE - 1 : 0]           prodReg;
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Unpack and compute the mantissa product
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   step0_facAMantissa;
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   step0_facBMantissa;
+    wire                                step0_sign;
+    wire [EXPONENT_SIZE - 1 : 0]        step0_exponentSum;
+    wire                                step0_exponentUnderflow;
+    wire                                step0_exponentOverflow;
+    wire                                step0_normalizationRequired;
+
+    FloatMulUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        unpack (
+            .facAIn(facAIn),
+            .facBIn(facBIn),
+            .facAMantissa(step0_facAMantissa),
+            .facBMantissa(step0_facBMantissa),
+            .sign(step0_sign),
+            .exponentSum(step0_exponentSum),
+            .exponentUnderflow(step0_exponentUnderflow),
+            .exponentOverflow(step0_exponentOverflow),
+            .normalizationRequired(step0_normalizationRequired)
+        );
 
-    reg  [EXPONENT_SUM_SIZE - 1 : 0]    one_facAExponent;
-    reg  [EXPONENT_SUM_SIZE - 1 : 0]    one_facBExponent;
     reg  [MANTISSA_PROD_SIZE - 1 : 0]   one_mantissaProd;
     reg                                 one_mantissaProdSign;
     reg  [EXPONENT_SIZE - 1 : 0]        one_exponentSum;
     reg                                 one_exponentUnderflow;
     reg                                 one_exponentOverflow;
+    reg                                 one_normalizationRequired;
+    always @(posedge clk)
+    if (ce) begin
+        one_mantissaProd <= step0_facBMantissa * step0_facAMantissa;
+        one_mantissaProdSign <= step0_sign;
+        one_exponentSum <= step0_exponentSum;
+        one_exponentUnderflow <= step0_exponentUnderflow;
+        one_exponentOverflow <= step0_exponentOverflow;
+        one_normalizationRequired <= step0_normalizationRequired;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Normalize and pack
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]           step1_prod;
+    reg  [FLOAT_SIZE - 1 : 0]           prodReg;
+
+    FloatMulPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        pack (
+            .mantissaProd(one_mantissaProd),
+            .sign(one_mantissaProdSign),
+            .exponentSum(one_exponentSum),
+            .exponentUnderflow(one_exponentUnderflow),
+            .exponentOverflow(one_exponentOverflow),
+            .normalizationRequired(one_normalizationRequired),
+            .prod(step1_prod)
+        );
+
     always @(posedge clk)
-    if (ce) begin : UnpackAndCompute
+    if (ce) begin
+        prodReg <= step1_prod;
+    end
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
+        currentIterationDelayer (.clk(clk), .ce(ce), .in(prodReg), .out(prod));
+endmodule
+
+// Unpacks the factors of a multiplication and computes the sign and the exponent of the product.
+// The mantissas are returned with the hidden bit. The product of both mantissas must be
+// calculated outside of this module, so that it can be mapped to an own multiplier
+// (see FloatMul and FloatMulDoublePumped).
+// This module is pure combinatorial logic
+module FloatMulUnpack
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam MANTISSA_CALC_SIZE = MANTISSA_SIZE + 1 // Add hidden bit
+)
+(
+    input  wire [FLOAT_SIZE - 1 : 0]            facAIn,
+    input  wire [FLOAT_SIZE - 1 : 0]            facBIn,
+    output reg  [MANTISSA_CALC_SIZE - 1 : 0]    facAMantissa,
+    output reg  [MANTISSA_CALC_SIZE - 1 : 0]    facBMantissa,
+    output reg                                  sign,
+    output reg  [EXPONENT_SIZE - 1 : 0]         exponentSum,
+    output reg                                  exponentUnderflow,
+    output reg                                  exponentOverflow,
+    output reg                                  normalizationRequired
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam EXPONENT_INF = (2 ** EXPONENT_SIZE) - 1;
+
+    localparam EXPONENT_SUM_ADDITIONAL_BITS = 1 + 1; // Add one bit for sign and one for overflow
+    localparam EXPONENT_SUM_SIZE = EXPONENT_SIZE + EXPONENT_SUM_ADDITIONAL_BITS; 
+
+    always @(*)
+    begin : UnpackAndCompute
         // Unpack
         reg  [FLOAT_SIZE - 1 : 0]   facA;
         reg  [FLOAT_SIZE - 1 : 0]   facB;
+        reg  [EXPONENT_SUM_SIZE - 1 : 0] facAExponent;
+        reg  [EXPONENT_SUM_SIZE - 1 : 0] facBExponent;
         reg                         expFacBGreaterThanZero;
         reg                         expFacAGreaterThanZero;
-        reg  [MANTISSA_CALC_SIZE - 1 : 0] facAMantissa;
-        reg  [MANTISSA_CALC_SIZE - 1 : 0] facBMantissa;
-        reg                         facASign;
-        reg                         facBSign;
         // Compute
         reg signed [EXPONENT_SUM_SIZE - 1 : 0]  sumExponent;
 
@@ -71,17 +157,14 @@ module FloatMul
         // Unpack
         //////////////////////////////////////
 
-        facA = facBIn;
-        facB = facAIn;
+        facA = facAIn;
+        facB = facBIn;
 
-        facASign = facA[SIGN_POS];
-        facBSign = facB[SIGN_POS];
+        facAExponent = {{EXPONENT_SUM_ADDITIONAL_BITS{1'b0}}, facA[EXPONENT_POS +: EXPONENT_SIZE]};
+        facBExponent = {{EXPONENT_SUM_ADDITIONAL_BITS{1'b0}}, facB[EXPONENT_POS +: EXPONENT_SIZE]};
 
-        one_facAExponent = {{EXPONENT_SUM_ADDITIONAL_BITS{1'b0}}, facA[EXPONENT_POS +: EXPONENT_SIZE]};
-        one_facBExponent = {{EXPONENT_SUM_ADDITIONAL_BITS{1'b0}}, facB[EXPONENT_POS +: EXPONENT_SIZE]};
-
-        expFacBGreaterThanZero = |one_facBExponent;
-        expFacAGreaterThanZero = |one_facAExponent;
+        expFacBGreaterThanZero = |facBExponent;
+        expFacAGreaterThanZero = |facAExponent;
 
         facAMantissa = {expFacAGreaterThanZero, facA[MANTISSA_POS +: MANTISSA_SIZE]};
         facBMantissa = {expFacBGreaterThanZero, facB[MANTISSA_POS +: MANTISSA_SIZE]};
@@ -90,57 +173,77 @@ module FloatMul
         // Compute
         //////////////////////////////////////
 
-        // Compute the mantissa product
-        one_mantissaProd <= facBMantissa * facAMantissa;
-
         // Compute the sign of the product
-        one_mantissaProdSign <= facASign ^ facBSign;
+        sign = facA[SIGN_POS] ^ facB[SIGN_POS];
+
+        // A denormalized product needs no normalization
+        normalizationRequired = expFacAGreaterThanZero || expFacBGreaterThanZero;
 
         // Compute the exponent
-        sumExponent = $signed(one_facBExponent) + ($signed(one_facAExponent) - EXPONENT_BIAS);
+        sumExponent = $signed(facBExponent) + ($signed(facAExponent) - EXPONENT_BIAS);
         
         // Clamp the exponent
         if ((sumExponent < 0) || (facBMantissa == 0) || (facAMantissa == 0))
         begin
-            one_exponentUnderflow <= 1;
-            one_exponentOverflow <= 0;
-            one_exponentSum <= 0;
+            exponentUnderflow = 1;
+            exponentOverflow = 0;
+            exponentSum = 0;
         end
         else if (sumExponent >= EXPONENT_INF)
         begin
-            one_exponentUnderflow <= 0;
-            one_exponentOverflow <= 1;
-            one_exponentSum <= EXPONENT_INF;
+            exponentUnderflow = 0;
+            exponentOverflow = 1;
+            exponentSum = EXPONENT_INF;
         end
         else 
         begin
-            one_exponentUnderflow <= 0;
-            one_exponentOverflow <= 0;
-            one_exponentSum <= sumExponent[0 +: EXPONENT_SIZE];
+            exponentUnderflow = 0;
+            exponentOverflow = 0;
+            exponentSum = sumExponent[0 +: EXPONENT_SIZE];
         end
     end
+endmodule
 
-    always @(posedge clk)
-    if (ce) begin : Pack
-        reg  [EXPONENT_SIZE - 1 : 0] exponentSum;
+// Normalizes the product of the mantissas (see FloatMulUnpack) and packs the result into a float.
+// This module is pure combinatorial logic
+module FloatMulPack
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam MANTISSA_PROD_SIZE = (MANTISSA_SIZE + 1) * 2
+)
+(
+    input  wire [MANTISSA_PROD_SIZE - 1 : 0]    mantissaProd,
+    input  wire                                 sign,
+    input  wire [EXPONENT_SIZE - 1 : 0]         exponentSum,
+    input  wire                                 exponentUnderflow,
+    input  wire                                 exponentOverflow,
+    input  wire                                 normalizationRequired,
+    output reg  [FLOAT_SIZE - 1 : 0]            prod
+);
+    localparam EXPONENT_INF = (2 ** EXPONENT_SIZE) - 1;
+
+    always @(*)
+    begin : Pack
+        reg  [EXPONENT_SIZE - 1 : 0] exponentSumNormalized;
         reg  [EXPONENT_SIZE : 0]     exponentSumTmp;
         reg  [MANTISSA_PROD_SIZE - 1 : 0] mantissaNormalized;
-        reg                          normalizationRequired;
         reg                          mantissaOverlow;
 
-        normalizationRequired = (one_facAExponent != 0) || (one_facBExponent != 0);
-        mantissaOverlow = one_mantissaProd[(MANTISSA_SIZE * 2) + 1];
+        mantissaOverlow = mantissaProd[(MANTISSA_SIZE * 2) + 1];
+        exponentSumTmp = 0;
 
         // Check if the exponent underflows (for instance when you multiply two numbers where the result is too small to encode)
-        if (one_exponentUnderflow)
+        if (exponentUnderflow)
         begin
-            exponentSum = 0;
+            exponentSumNormalized = 0;
             mantissaNormalized = 0;
         end
         // Check if the exponent overflows (for instance when you multiply two numbers where the result is too big to encode)
-        else if (one_exponentOverflow)
+        else if (exponentOverflow)
         begin
-            exponentSum = EXPONENT_INF;
+            exponentSumNormalized = EXPONENT_INF;
             mantissaNormalized = 0;
         end
         else 
@@ -150,7 +253,7 @@ module FloatMul
             if (normalizationRequired)
             begin
                 // Standard case where we have a normalized mantissa. In this case we can just use the calculated sum.
-                exponentSumTmp = one_exponentSum + {{EXPONENT_SIZE{1'b0}}, mantissaOverlow};
+                exponentSumTmp = exponentSum + {{EXPONENT_SIZE{1'b0}}, mantissaOverlow};
             end
             else
             begin
@@ -158,7 +261,7 @@ module FloatMul
                 exponentSumTmp = 0;
             end
 
-            exponentSum = exponentSumTmp[0 +: EXPONENT_SIZE];
+            exponentSumNormalized = exponentSumTmp[0 +: EXPONENT_SIZE];
 
             // Check if we have to normalize the mantissa
             if (exponentSumTmp == EXPONENT_INF)
@@ -167,18 +270,15 @@ module FloatMul
             end
             else if (normalizationRequired)
             begin
-                mantissaNormalized = one_mantissaProd >> ({{(MANTISSA_PROD_SIZE - MANTISSA_SIZE){1'b0}}, MANTISSA_SIZE[0 +: MANTISSA_SIZE]} 
+                mantissaNormalized = mantissaProd >> ({{(MANTISSA_PROD_SIZE - MANTISSA_SIZE){1'b0}}, MANTISSA_SIZE[0 +: MANTISSA_SIZE]} 
                                                                  + {{(MANTISSA_PROD_SIZE - 1){1'b0}}, mantissaOverlow});
             end
             else 
             begin
-                mantissaNormalized = one_mantissaProd;
+                mantissaNormalized = mantissaProd;
             end
         end
 
-        prodReg <= {one_mantissaProdSign, exponentSum, mantissaNormalized[0 +: MANTISSA_SIZE]};
+        prod = {sign, exponentSumNormalized, mantissaNormalized[0 +: MANTISSA_SIZE]};
     end
-
-    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
-        currentIterationDelayer (.clk(clk), .ce(ce), .in(prodReg), .out(prod));
 endmodule
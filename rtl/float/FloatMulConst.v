@@ -0,0 +1,203 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point multiplication with a constant
+// The mantissa multiplication is implemented as shift and add network without DSPs. The constant
+// is converted into the canonical signed digit (CSD) representation, so that a minimal number of
+// additions and substractions is required. The additions are split into groups which are summed
+// up in the first step and added together in the second step.
+// When the constant is a power of two, the multiplication is only an adaption of the exponent.
+// The results are bit exact to the results of the FloatMul.
+// CONSTANT is the bit pattern of the float, for instance 32'h40490fdb for 3.14159265
+// This module is pipelined. It can calculate one multiplication per clock
+// This module has a latency of 3 clock cycles minimum
+module FloatMulConst
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter [EXPONENT_SIZE + MANTISSA_SIZE : 0] CONSTANT = 32'h40000000, // 2.0
+    parameter DELAY = 1, // Use this delay to add clock cycles. It adds by default 1 clock cycle, so that the multiplier has the same latency as the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_MUL_CONST_LATENCY(DELAY)
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] in,
+    output wire [FLOAT_SIZE - 1 : 0] prod
+);
+    localparam MANTISSA_CALC_SIZE = MANTISSA_SIZE + 1; // Add hidden bit
+    localparam MANTISSA_PROD_SIZE = MANTISSA_CALC_SIZE * 2;
+    localparam FLAGS_SIZE = 1 + EXPONENT_SIZE + 1 + 1 + 1; // Sign, exponent, underflow, overflow, normalization required
+    localparam CSD_SIZE = MANTISSA_CALC_SIZE + 1; // The CSD representation can require one more digit
+    localparam GROUPS = 4;
+    localparam GROUP_SIZE = (CSD_SIZE + GROUPS - 1) / GROUPS;
+
+    // Converts a number into the canonical signed digit representation.
+    // Returns the positive or the negative digits as mask.
+    function [CSD_SIZE - 1 : 0] csdDigits;
+        input [CSD_SIZE - 1 : 0]    value;
+        input                       negative;
+        reg   [CSD_SIZE : 0]        v;
+        integer                     i;
+        begin
+            csdDigits = 0;
+            v = { 1'b0, value };
+            for (i = 0; i < CSD_SIZE; i = i + 1)
+            begin
+                if (v[0])
+                begin
+                    if (v[1])
+                    begin
+                        // Remainder 3: Use -1 and carry the rest to the next digit
+                        csdDigits[i] = negative;
+                        v = v + 1;
+                    end
+                    else
+                    begin
+                        csdDigits[i] = !negative;
+                        v = v - 1;
+                    end
+                end
+                v = v >> 1;
+            end
+        end
+    endfunction
+
+    localparam [MANTISSA_CALC_SIZE - 1 : 0] CONSTANT_MANTISSA = { |CONSTANT[MANTISSA_SIZE +: EXPONENT_SIZE], CONSTANT[0 +: MANTISSA_SIZE] };
+    localparam [CSD_SIZE - 1 : 0] CSD_POSITIVE = csdDigits({ 1'b0, CONSTANT_MANTISSA }, 0);
+    localparam [CSD_SIZE - 1 : 0] CSD_NEGATIVE = csdDigits({ 1'b0, CONSTANT_MANTISSA }, 1);
+    localparam IS_POWER_OF_TWO = CONSTANT_MANTISSA == { 1'b1, { MANTISSA_SIZE { 1'b0 } } };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Unpack, sign and exponent. The unpack logic of the constant is removed by the synthesis.
+    // Clocks: 0
+    ////////////////////////////////////////////////////////////////////////////
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   step0_mantissa;
+    wire [FLAGS_SIZE - 1 : 0]           step0_flags;
+    wire [FLAGS_SIZE - 1 : 0]           step2_flags;
+
+    FloatMulUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        unpack (
+            .facAIn(in),
+            .facBIn(CONSTANT),
+            .facAMantissa(step0_mantissa),
+            .facBMantissa(),
+            .sign(step0_flags[FLAGS_SIZE - 1]),
+            .exponentSum(step0_flags[3 +: EXPONENT_SIZE]),
+            .exponentUnderflow(step0_flags[2]),
+            .exponentOverflow(step0_flags[1]),
+            .normalizationRequired(step0_flags[0])
+        );
+
+    ValueDelay #(.VALUE_SIZE(FLAGS_SIZE), .DELAY(2)) 
+        flagsDelay (.clk(clk), .ce(ce), .in(step0_flags), .out(step2_flags));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1 and 2
+    // Mantissa multiplication
+    // Clocks: 2
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [MANTISSA_PROD_SIZE - 1 : 0]   two_mantissaProd;
+
+    generate
+        if (IS_POWER_OF_TWO)
+        begin : PowerOfTwo
+            // The mantissa of the constant is 1.0. No multiplication is required.
+            reg  [MANTISSA_CALC_SIZE - 1 : 0] one_mantissa;
+            always @(posedge clk)
+            if (ce) begin
+                one_mantissa <= step0_mantissa;
+                two_mantissaProd <= { { (MANTISSA_PROD_SIZE - MANTISSA_CALC_SIZE - MANTISSA_SIZE) { 1'b0 } }, one_mantissa, { MANTISSA_SIZE { 1'b0 } } };
+            end
+        end
+        else
+        begin : ShiftAndAdd
+            (* use_dsp = "no" *) reg  [MANTISSA_PROD_SIZE - 1 : 0] one_groupSum [0 : GROUPS - 1];
+            always @(posedge clk)
+            if (ce) begin : GroupSum
+                reg  [MANTISSA_PROD_SIZE - 1 : 0]   groupSum;
+                reg  [MANTISSA_PROD_SIZE - 1 : 0]   mantissa;
+                integer                             i;
+                integer                             j;
+
+                mantissa = { { (MANTISSA_PROD_SIZE - MANTISSA_CALC_SIZE) { 1'b0 } }, step0_mantissa };
+                for (i = 0; i < GROUPS; i = i + 1)
+                begin
+                    // The sums are calculated modulo 2 ** MANTISSA_PROD_SIZE. A group sum can be negative,
+                    // but the sum of all groups is the positive product which always fits.
+                    groupSum = 0;
+                    for (j = i * GROUP_SIZE; (j < ((i + 1) * GROUP_SIZE)) && (j < CSD_SIZE); j = j + 1)
+                    begin
+                        if (CSD_POSITIVE[j])
+                        begin
+                            groupSum = groupSum + (mantissa << j);
+                        end
+                        if (CSD_NEGATIVE[j])
+                        begin
+                            groupSum = groupSum - (mantissa << j);
+                        end
+                    end
+                    one_groupSum[i] <= groupSum;
+                end
+            end
+
+            always @(posedge clk)
+            if (ce) begin : Sum
+                reg  [MANTISSA_PROD_SIZE - 1 : 0] sum;
+                integer                           i;
+
+                sum = 0;
+                for (i = 0; i < GROUPS; i = i + 1)
+                begin
+                    sum = sum + one_groupSum[i];
+                end
+                two_mantissaProd <= sum;
+            end
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Normalize and pack
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]           step3_prod;
+    reg  [FLOAT_SIZE - 1 : 0]           prodReg;
+
+    FloatMulPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        pack (
+            .mantissaProd(two_mantissaProd),
+            .sign(step2_flags[FLAGS_SIZE - 1]),
+            .exponentSum(step2_flags[3 +: EXPONENT_SIZE]),
+            .exponentUnderflow(step2_flags[2]),
+            .exponentOverflow(step2_flags[1]),
+            .normalizationRequired(step2_flags[0]),
+            .prod(step3_prod)
+        );
+
+    always @(posedge clk)
+    if (ce) begin
+        prodReg <= step3_prod;
+    end
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
+        prodDelay (.clk(clk), .ce(ce), .in(prodReg), .out(prod));
+endmodule
@@ -0,0 +1,143 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point multiplication of two independent streams which share one mantissa multiplier.
+// The mantissa multiplier runs with clk2x (see DoublePumpedMul), all other logic runs with clk.
+// The results are bit exact to the results of two FloatMul.
+// This module is pipelined. It can calculate two multiplications per clock
+// This module has a latency of 4 clock cycles minimum
+module FloatMulDoublePumped
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter DELAY = 0, // Use this delay to add clock cycles.
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_MUL_DOUBLE_PUMPED_LATENCY(DELAY)
+)
+(
+    input  wire                      clk,
+    input  wire                      clk2x,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] facA0In,
+    input  wire [FLOAT_SIZE - 1 : 0] facB0In,
+    input  wire [FLOAT_SIZE - 1 : 0] facA1In,
+    input  wire [FLOAT_SIZE - 1 : 0] facB1In,
+    output wire [FLOAT_SIZE - 1 : 0] prod0,
+    output wire [FLOAT_SIZE - 1 : 0] prod1
+);
+    localparam MANTISSA_CALC_SIZE = MANTISSA_SIZE + 1; // Add hidden bit
+    localparam MANTISSA_PROD_SIZE = MANTISSA_CALC_SIZE * 2;
+    localparam FLAGS_SIZE = 1 + EXPONENT_SIZE + 1 + 1 + 1; // Sign, exponent, underflow, overflow, normalization required
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Unpack and compute the mantissa products of both streams
+    // Clocks: 3
+    ////////////////////////////////////////////////////////////////////////////
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   step0_facAMantissa [0 : 1];
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   step0_facBMantissa [0 : 1];
+    wire [(2 * FLAGS_SIZE) - 1 : 0]     step0_flags; // Stream 0 uses the LSBs
+    wire [MANTISSA_PROD_SIZE - 1 : 0]   step0_mantissaProd [0 : 1];
+    wire [(2 * FLAGS_SIZE) - 1 : 0]     step0_flagsDelayed;
+
+    FloatMulUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        unpack0 (
+            .facAIn(facA0In),
+            .facBIn(facB0In),
+            .facAMantissa(step0_facAMantissa[0]),
+            .facBMantissa(step0_facBMantissa[0]),
+            .sign(step0_flags[FLAGS_SIZE - 1]),
+            .exponentSum(step0_flags[3 +: EXPONENT_SIZE]),
+            .exponentUnderflow(step0_flags[2]),
+            .exponentOverflow(step0_flags[1]),
+            .normalizationRequired(step0_flags[0])
+        );
+
+    FloatMulUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        unpack1 (
+            .facAIn(facA1In),
+            .facBIn(facB1In),
+            .facAMantissa(step0_facAMantissa[1]),
+            .facBMantissa(step0_facBMantissa[1]),
+            .sign(step0_flags[(2 * FLAGS_SIZE) - 1]),
+            .exponentSum(step0_flags[FLAGS_SIZE + 3 +: EXPONENT_SIZE]),
+            .exponentUnderflow(step0_flags[FLAGS_SIZE + 2]),
+            .exponentOverflow(step0_flags[FLAGS_SIZE + 1]),
+            .normalizationRequired(step0_flags[FLAGS_SIZE])
+        );
+
+    DoublePumpedMul #(.A_SIZE(MANTISSA_CALC_SIZE), .B_SIZE(MANTISSA_CALC_SIZE))
+        mantissaMul (
+            .clk(clk),
+            .clk2x(clk2x),
+            .ce(ce),
+            .a0(step0_facBMantissa[0]),
+            .b0(step0_facAMantissa[0]),
+            .a1(step0_facBMantissa[1]),
+            .b1(step0_facAMantissa[1]),
+            .prod0(step0_mantissaProd[0]),
+            .prod1(step0_mantissaProd[1])
+        );
+
+    ValueDelay #(.VALUE_SIZE(2 * FLAGS_SIZE), .DELAY(`DOUBLE_PUMPED_MUL_LATENCY)) 
+        flagsDelay (
+            .clk(clk),
+            .ce(ce),
+            .in(step0_flags),
+            .out(step0_flagsDelayed)
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Normalize and pack
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]           step1_prod [0 : 1];
+    reg  [FLOAT_SIZE - 1 : 0]           prod0Reg;
+    reg  [FLOAT_SIZE - 1 : 0]           prod1Reg;
+
+    generate
+        genvar i;
+        for (i = 0; i < 2; i = i + 1)
+        begin : Pack
+            FloatMulPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                pack (
+                    .mantissaProd(step0_mantissaProd[i]),
+                    .sign(step0_flagsDelayed[(i * FLAGS_SIZE) + FLAGS_SIZE - 1]),
+                    .exponentSum(step0_flagsDelayed[(i * FLAGS_SIZE) + 3 +: EXPONENT_SIZE]),
+                    .exponentUnderflow(step0_flagsDelayed[(i * FLAGS_SIZE) + 2]),
+                    .exponentOverflow(step0_flagsDelayed[(i * FLAGS_SIZE) + 1]),
+                    .normalizationRequired(step0_flagsDelayed[(i * FLAGS_SIZE) + 0]),
+                    .prod(step1_prod[i])
+                );
+        end
+    endgenerate
+
+    always @(posedge clk)
+    if (ce) begin
+        prod0Reg <= step1_prod[0];
+        prod1Reg <= step1_prod[1];
+    end
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
+        prod0Delay (.clk(clk), .ce(ce), .in(prod0Reg), .out(prod0));
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
+        prod1Delay (.clk(clk), .ce(ce), .in(prod1Reg), .out(prod1));
+endmodule
@@ -0,0 +1,108 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point multiplication in the unpacked format (see FloatUnpack)
+// Compared to the FloatMul, it saves the unpacking and the normalization of the result.
+// The mantissa of the product is truncated.
+// This module is pipelined. It can calculate one multiplication per clock
+// This module has a latency of 1 clock cycle minimum
+module FloatMulUnpacked
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    parameter DELAY = 0, // Use this delay to add clock cycles.
+    localparam UNPACKED_EXPONENT_SIZE = EXPONENT_SIZE + 2,
+    localparam UNPACKED_MANTISSA_SIZE = 2 + MANTISSA_SIZE + GUARD_SIZE,
+    localparam UNPACKED_SIZE = 1 + UNPACKED_EXPONENT_SIZE + UNPACKED_MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_MUL_UNPACKED_LATENCY(DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [UNPACKED_SIZE - 1 : 0] facAIn,
+    input  wire [UNPACKED_SIZE - 1 : 0] facBIn,
+    output wire [UNPACKED_SIZE - 1 : 0] prod
+);
+    localparam UNPACKED_MANTISSA_POS = 0;
+    localparam UNPACKED_EXPONENT_POS = UNPACKED_MANTISSA_SIZE;
+    localparam UNPACKED_SIGN_POS = UNPACKED_EXPONENT_POS + UNPACKED_EXPONENT_SIZE;
+
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam EXPONENT_CALC_SIZE = UNPACKED_EXPONENT_SIZE + 2; // Add one bit for the sum and one for the normalization
+    localparam FRACTION_SIZE = MANTISSA_SIZE + GUARD_SIZE;
+    localparam FACTOR_SIZE = 1 + FRACTION_SIZE; // Mantissa normalized to 1.0 .. 1.999..
+    localparam PROD_SIZE = FACTOR_SIZE * 2;
+
+    localparam signed [EXPONENT_CALC_SIZE - 1 : 0] UNPACKED_EXPONENT_MIN = -(2 ** (UNPACKED_EXPONENT_SIZE - 1));
+    localparam signed [EXPONENT_CALC_SIZE - 1 : 0] UNPACKED_EXPONENT_MAX = (2 ** (UNPACKED_EXPONENT_SIZE - 1)) - 1;
+
+    reg  [UNPACKED_SIZE - 1 : 0] prodReg;
+
+    always @(posedge clk)
+    if (ce) begin : Mul
+        reg  [UNPACKED_MANTISSA_SIZE - 1 : 0]       facAMantissa;
+        reg  [UNPACKED_MANTISSA_SIZE - 1 : 0]       facBMantissa;
+        reg  [FACTOR_SIZE - 1 : 0]                  facAFactor;
+        reg  [FACTOR_SIZE - 1 : 0]                  facBFactor;
+        reg  signed [EXPONENT_CALC_SIZE - 1 : 0]    facAExponent;
+        reg  signed [EXPONENT_CALC_SIZE - 1 : 0]    facBExponent;
+        reg  signed [EXPONENT_CALC_SIZE - 1 : 0]    sumExponent;
+        reg  [PROD_SIZE - 1 : 0]                    mantissaProd;
+        reg  [UNPACKED_EXPONENT_SIZE - 1 : 0]       prodExponent;
+        reg  [UNPACKED_MANTISSA_SIZE - 1 : 0]       prodMantissa;
+
+        facAMantissa = facAIn[UNPACKED_MANTISSA_POS +: UNPACKED_MANTISSA_SIZE];
+        facBMantissa = facBIn[UNPACKED_MANTISSA_POS +: UNPACKED_MANTISSA_SIZE];
+        facAExponent = $signed({ { 2 { facAIn[UNPACKED_SIGN_POS - 1] } }, facAIn[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE] });
+        facBExponent = $signed({ { 2 { facBIn[UNPACKED_SIGN_POS - 1] } }, facBIn[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE] });
+
+        // Normalize the mantissas from 1.0 .. 3.999.. to 1.0 .. 1.999.. so that the product is in a range of 1.0 .. 3.999..
+        // The truncated bit is a guard bit.
+        facAFactor = (facAMantissa[UNPACKED_MANTISSA_SIZE - 1]) ? facAMantissa[1 +: FACTOR_SIZE] : facAMantissa[0 +: FACTOR_SIZE];
+        facBFactor = (facBMantissa[UNPACKED_MANTISSA_SIZE - 1]) ? facBMantissa[1 +: FACTOR_SIZE] : facBMantissa[0 +: FACTOR_SIZE];
+
+        sumExponent = facAExponent + facBExponent - EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE]
+            + { { (EXPONENT_CALC_SIZE - 1) { 1'b0 } }, facAMantissa[UNPACKED_MANTISSA_SIZE - 1] }
+            + { { (EXPONENT_CALC_SIZE - 1) { 1'b0 } }, facBMantissa[UNPACKED_MANTISSA_SIZE - 1] };
+
+        mantissaProd = facAFactor * facBFactor;
+        prodMantissa = mantissaProd[FRACTION_SIZE +: UNPACKED_MANTISSA_SIZE];
+
+        // Clamp the exponent, so that it can't wrap around in a long chain of operations
+        if ((facAMantissa == 0) || (facBMantissa == 0) || (sumExponent < UNPACKED_EXPONENT_MIN))
+        begin
+            prodExponent = UNPACKED_EXPONENT_MIN[0 +: UNPACKED_EXPONENT_SIZE];
+            prodMantissa = 0;
+        end
+        else if (sumExponent > UNPACKED_EXPONENT_MAX)
+        begin
+            prodExponent = UNPACKED_EXPONENT_MAX[0 +: UNPACKED_EXPONENT_SIZE];
+        end
+        else
+        begin
+            prodExponent = sumExponent[0 +: UNPACKED_EXPONENT_SIZE];
+        end
+
+        prodReg <= { facAIn[UNPACKED_SIGN_POS] ^ facBIn[UNPACKED_SIGN_POS], prodExponent, prodMantissa };
+    end
+
+    ValueDelay #(.VALUE_SIZE(UNPACKED_SIZE), .DELAY(DELAY)) 
+        prodDelay (.clk(clk), .ce(ce), .in(prodReg), .out(prod));
+endmodule
@@ -0,0 +1,102 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Converts a number in the unpacked format (see FloatUnpack) back into a float.
+// The guard bits are rounded to the nearest number, ties are rounded away from zero.
+// Numbers which are too big are converted to inf, too small numbers to a denormalized float or zero.
+// This module is pipelined. It can pack one float per clock
+// This module has a latency of 1 clock cycle
+module FloatPack
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam UNPACKED_EXPONENT_SIZE = EXPONENT_SIZE + 2,
+    localparam UNPACKED_MANTISSA_SIZE = 2 + MANTISSA_SIZE + GUARD_SIZE,
+    localparam UNPACKED_SIZE = 1 + UNPACKED_EXPONENT_SIZE + UNPACKED_MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_PACK_LATENCY
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [UNPACKED_SIZE - 1 : 0] in,
+    output reg  [FLOAT_SIZE - 1 : 0]    out
+);
+    localparam UNPACKED_MANTISSA_POS = 0;
+    localparam UNPACKED_EXPONENT_POS = UNPACKED_MANTISSA_SIZE;
+    localparam UNPACKED_SIGN_POS = UNPACKED_EXPONENT_POS + UNPACKED_EXPONENT_SIZE;
+
+    localparam EXPONENT_INF = (2 ** EXPONENT_SIZE) - 1;
+    localparam EXPONENT_CALC_SIZE = UNPACKED_EXPONENT_SIZE + 1; // Add one bit for the normalization
+    localparam NORMALIZED_SIZE = 1 + MANTISSA_SIZE + GUARD_SIZE; // Hidden bit, fraction and guard bits
+
+    always @(posedge clk)
+    if (ce) begin : Pack
+        reg  [UNPACKED_MANTISSA_SIZE - 1 : 0]       mantissa;
+        reg  signed [EXPONENT_CALC_SIZE - 1 : 0]    exponent;
+        reg  [NORMALIZED_SIZE - 1 : 0]              normalized;
+        reg  [EXPONENT_CALC_SIZE - 1 : 0]           shift;
+        reg  [EXPONENT_SIZE - 1 : 0]                packedExponent;
+        reg  [EXPONENT_SIZE + MANTISSA_SIZE - 1 : 0] packed;
+
+        mantissa = in[UNPACKED_MANTISSA_POS +: UNPACKED_MANTISSA_SIZE];
+        exponent = $signed({ in[UNPACKED_EXPONENT_POS + UNPACKED_EXPONENT_SIZE - 1], in[UNPACKED_EXPONENT_POS +: UNPACKED_EXPONENT_SIZE] });
+
+        // Normalize the mantissa from 1.0 .. 3.999.. to 1.0 .. 1.999..
+        if (mantissa[UNPACKED_MANTISSA_SIZE - 1])
+        begin
+            normalized = mantissa[1 +: NORMALIZED_SIZE];
+            exponent = exponent + { { (EXPONENT_CALC_SIZE - 1) { 1'b0 } }, 1'b1 };
+        end
+        else
+        begin
+            normalized = mantissa[0 +: NORMALIZED_SIZE];
+        end
+
+        if (exponent < 1)
+        begin
+            // Denormalize the mantissa, the exponent of a denormalized float is 1, but encoded as 0
+            shift = { { (EXPONENT_CALC_SIZE - 1) { 1'b0 } }, 1'b1 } - exponent;
+            normalized = normalized >> shift;
+            packedExponent = 0;
+        end
+        else if (exponent >= EXPONENT_INF)
+        begin
+            packedExponent = EXPONENT_INF;
+            normalized = 0;
+        end
+        else
+        begin
+            packedExponent = exponent[0 +: EXPONENT_SIZE];
+        end
+
+        // Round with the MSb of the guard bits. An overflow of the mantissa increments
+        // the exponent. This also converts a denormalized number into a normalized one
+        // and a too big number into inf.
+        packed = { packedExponent, normalized[GUARD_SIZE +: MANTISSA_SIZE] } + { { (EXPONENT_SIZE + MANTISSA_SIZE - 1) { 1'b0 } }, normalized[GUARD_SIZE - 1] };
+
+        if (mantissa == 0)
+        begin
+            packed = 0;
+        end
+
+        out <= { in[UNPACKED_SIGN_POS], packed };
+    end
+endmodule
@@ -0,0 +1,324 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Rasterizes a triangle into quads of QUAD_SIZE x QUAD_SIZE pixels (QUAD_SIZE is 2 or 4).
+// The setup calculates the three edge functions E(x, y) = A * x + B * y + C of the edges from vertex i
+// to vertex j with A = yi - yj, B = xj - xi and C = xi * yj - xj * yi with FloatSubs and FloatMuls.
+// The coefficients are converted once with a FloatToInt into fixed point, scaled via the 'offset' of
+// the FloatToInt with 2 ** SUBPIXEL_BITS (A and B) and 2 ** (2 * SUBPIXEL_BITS) (C). Afterwards the
+// edge functions are stepped with integer additions. Per clock, all pixels of one quad are tested.
+// A pixel is covered, when all edge functions are positive at its center. Vertices must be ordered
+// so that this is the case inside of the triangle (clockwise with y pointing down), other triangles
+// are culled. Pixels on an edge are covered when A > 0 or A == 0 and B > 0, so that a pixel on an edge
+// which is shared by two triangles is only covered by one of them.
+// The vertices are relative to the upper left corner of the rasterized region (for instance the bounding
+// box or a tile). inMaxX and inMaxY are the positions of the last quad of the region. The setup is exact,
+// when the vertices are on the subpixel grid and their coordinates have at most 11 bits on this grid
+// (for instance |x| < 128 with SUBPIXEL_BITS = 4), because then all products and differences fit into
+// the mantissa. Otherwise the coefficients are rounded by the FloatMul, FloatSub and FloatToInt.
+// Only quads with at least one covered pixel are sent via the out interface. outX and outY are the
+// position of the quad in quads, bit (y * QUAD_SIZE) + x of outMask is the pixel (x, y) of the quad.
+// inTag is forwarded with every quad of the triangle.
+// The setup of the next triangle runs while the current triangle is rasterized. resetn must be
+// asserted for at least LATENCY clocks.
+// This module can test one quad per clock. The setup has a latency of 2 + MUL_DELAY + 4 + 2 + 1 clock cycles
+module FloatRasterizer
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter SUBPIXEL_BITS = 4, // Must be at least 1
+    parameter QUAD_SIZE = 2,
+    parameter COORD_SIZE = 6,
+    parameter TAG_SIZE = 1,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam QUAD_PIXELS = QUAD_SIZE * QUAD_SIZE,
+    localparam LATENCY = `FLOAT_RASTERIZER_SETUP_LATENCY(MUL_DELAY)
+)
+(
+    input  wire                                 clk,
+    input  wire                                 resetn,
+
+    input  wire                                 inValid,
+    output wire                                 inReady,
+    input  wire [FLOAT_SIZE - 1 : 0]            inX0,
+    input  wire [FLOAT_SIZE - 1 : 0]            inY0,
+    input  wire [FLOAT_SIZE - 1 : 0]            inX1,
+    input  wire [FLOAT_SIZE - 1 : 0]            inY1,
+    input  wire [FLOAT_SIZE - 1 : 0]            inX2,
+    input  wire [FLOAT_SIZE - 1 : 0]            inY2,
+    input  wire [COORD_SIZE - 1 : 0]            inMaxX,
+    input  wire [COORD_SIZE - 1 : 0]            inMaxY,
+    input  wire [TAG_SIZE - 1 : 0]              inTag,
+
+    output reg                                  outValid = 0,
+    input  wire                                 outReady,
+    output reg  [COORD_SIZE - 1 : 0]            outX,
+    output reg  [COORD_SIZE - 1 : 0]            outY,
+    output reg  [QUAD_PIXELS - 1 : 0]           outMask,
+    output reg  [TAG_SIZE - 1 : 0]              outTag
+);
+    localparam INT_SIZE = 32;
+    localparam MUL_LATENCY = `FLOAT_MUL_LATENCY(MUL_DELAY);
+    localparam FLOAT_LATENCY = MUL_LATENCY + `FLOAT_SUB_LATENCY;
+    localparam INT_LATENCY = FLOAT_LATENCY + `FLOAT_TO_INT_LATENCY(0);
+    localparam QUAD_SIZE_LOG2 = $clog2(QUAD_SIZE);
+    localparam REGION_SIZE = (2 * COORD_SIZE) + TAG_SIZE;
+    localparam signed [EXPONENT_SIZE - 1 : 0] AB_OFFSET = -SUBPIXEL_BITS;
+    localparam signed [EXPONENT_SIZE - 1 : 0] C_OFFSET = -(2 * SUBPIXEL_BITS);
+
+    wire [(3 * FLOAT_SIZE) - 1 : 0] xs = { inX2, inX1, inX0 };
+    wire [(3 * FLOAT_SIZE) - 1 : 0] ys = { inY2, inY1, inY0 };
+    wire                            setup = inValid && inReady;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Edge coefficients in float and conversion into fixed point
+    // Clocks: FLOAT_MUL_LATENCY + FLOAT_SUB_LATENCY + FLOAT_TO_INT_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [(3 * INT_SIZE) - 1 : 0]   edgeA;
+    wire [(3 * INT_SIZE) - 1 : 0]   edgeB;
+    wire [(3 * INT_SIZE) - 1 : 0]   edgeC;
+    wire                            setupDone;
+    wire [REGION_SIZE - 1 : 0]      setupRegion;
+
+    generate
+        genvar e;
+        for (e = 0; e < 3; e = e + 1)
+        begin : Edge
+            localparam J = (e + 1) % 3;
+            wire [FLOAT_SIZE - 1 : 0]   xi = xs[e * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   yi = ys[e * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   xj = xs[J * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   yj = ys[J * FLOAT_SIZE +: FLOAT_SIZE];
+            wire [FLOAT_SIZE - 1 : 0]   a;
+            wire [FLOAT_SIZE - 1 : 0]   b;
+            wire [FLOAT_SIZE - 1 : 0]   aDelayed;
+            wire [FLOAT_SIZE - 1 : 0]   bDelayed;
+            wire [FLOAT_SIZE - 1 : 0]   prod0;
+            wire [FLOAT_SIZE - 1 : 0]   prod1;
+            wire [FLOAT_SIZE - 1 : 0]   c;
+
+            FloatSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                aSub (.clk(clk), .ce(1'b1), .aIn(yi), .bIn(yj), .sum(a));
+
+            FloatSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                bSub (.clk(clk), .ce(1'b1), .aIn(xj), .bIn(xi), .sum(b));
+
+            ValueDelay #(.VALUE_SIZE(2 * FLOAT_SIZE), .DELAY(MUL_LATENCY)) 
+                abDelay (.clk(clk), .ce(1'b1), .in({ b, a }), .out({ bDelayed, aDelayed }));
+
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                mul0 (.clk(clk), .ce(1'b1), .facAIn(xi), .facBIn(yj), .prod(prod0));
+
+            FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                mul1 (.clk(clk), .ce(1'b1), .facAIn(xj), .facBIn(yi), .prod(prod1));
+
+            FloatSub #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                cSub (.clk(clk), .ce(1'b1), .aIn(prod0), .bIn(prod1), .sum(c));
+
+            FloatToInt #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(INT_SIZE), .DELAY(0))
+                aToFixed (.clk(clk), .ce(1'b1), .offset(AB_OFFSET), .in(aDelayed), .out(edgeA[e * INT_SIZE +: INT_SIZE]));
+
+            FloatToInt #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(INT_SIZE), .DELAY(0))
+                bToFixed (.clk(clk), .ce(1'b1), .offset(AB_OFFSET), .in(bDelayed), .out(edgeB[e * INT_SIZE +: INT_SIZE]));
+
+            FloatToInt #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(INT_SIZE), .DELAY(0))
+                cToFixed (.clk(clk), .ce(1'b1), .offset(C_OFFSET), .in(c), .out(edgeC[e * INT_SIZE +: INT_SIZE]));
+        end
+    endgenerate
+
+    ValueDelay #(.VALUE_SIZE(1 + REGION_SIZE), .DELAY(INT_LATENCY)) 
+        setupDelay (.clk(clk), .ce(1'b1), .in({ setup, inTag, inMaxY, inMaxX }), .out({ setupDone, setupRegion }));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Start values and steps of the pixels
+    // The edge function is evaluated at the center of the pixel:
+    // E(x + 0.5, y + 0.5) * 2 ** (2 * SUBPIXEL_BITS) = (A * ((x << SUBPIXEL_BITS) + 2 ** (SUBPIXEL_BITS - 1)))
+    //    + (B * ((y << SUBPIXEL_BITS) + 2 ** (SUBPIXEL_BITS - 1))) + C
+    // The tie breaking rule is added as bias to the start value.
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                             setupBusy = 0;
+    reg                             slotFull = 0;
+    reg  [(3 * INT_SIZE) - 1 : 0]   slotStart;
+    reg  [(3 * INT_SIZE) - 1 : 0]   slotStepX;
+    reg  [(3 * INT_SIZE) - 1 : 0]   slotStepY;
+    reg  [REGION_SIZE - 1 : 0]      slotRegion;
+    wire                            load;
+
+    // Only one triangle is in the setup, its result is kept in the slot until the last one is rasterized
+    assign inReady = resetn && !setupBusy && !slotFull;
+
+    always @(posedge clk)
+    begin
+        if (!resetn)
+        begin
+            setupBusy <= 0;
+            slotFull <= 0;
+        end
+        else
+        begin
+            if (setup)
+            begin
+                setupBusy <= 1;
+            end
+            if (setupDone)
+            begin
+                setupBusy <= 0;
+                slotFull <= 1;
+            end
+            if (load)
+            begin
+                slotFull <= 0;
+            end
+        end
+    end
+
+    always @(posedge clk)
+    begin : Slot
+        integer i;
+        reg signed [INT_SIZE - 1 : 0] a;
+        reg signed [INT_SIZE - 1 : 0] b;
+        reg signed [INT_SIZE - 1 : 0] c;
+        reg signed [INT_SIZE - 1 : 0] bias;
+
+        if (setupDone)
+        begin
+            for (i = 0; i < 3; i = i + 1)
+            begin
+                a = edgeA[i * INT_SIZE +: INT_SIZE];
+                b = edgeB[i * INT_SIZE +: INT_SIZE];
+                c = edgeC[i * INT_SIZE +: INT_SIZE];
+                bias = ((a > 0) || ((a == 0) && (b > 0))) ? 0 : -1;
+                slotStart[i * INT_SIZE +: INT_SIZE] <= c + ((a + b) <<< (SUBPIXEL_BITS - 1)) + bias;
+                slotStepX[i * INT_SIZE +: INT_SIZE] <= a <<< SUBPIXEL_BITS;
+                slotStepY[i * INT_SIZE +: INT_SIZE] <= b <<< SUBPIXEL_BITS;
+            end
+            slotRegion <= setupRegion;
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Walk the quads of the region and test the pixels of the quads
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg                             active = 0;
+    reg  [(3 * INT_SIZE) - 1 : 0]   row; // Value at the first quad of the current row
+    reg  [(3 * INT_SIZE) - 1 : 0]   value; // Value at the current quad
+    reg  [(3 * INT_SIZE) - 1 : 0]   stepX;
+    reg  [(3 * INT_SIZE) - 1 : 0]   stepY;
+    reg  [COORD_SIZE - 1 : 0]       x;
+    reg  [COORD_SIZE - 1 : 0]       y;
+    reg  [COORD_SIZE - 1 : 0]       maxX;
+    reg  [COORD_SIZE - 1 : 0]       maxY;
+    reg  [TAG_SIZE - 1 : 0]         tag;
+    reg  [QUAD_PIXELS - 1 : 0]      mask;
+    wire                            advance = !outValid || outReady;
+
+    assign load = !active && slotFull && resetn;
+
+    always @(*)
+    begin : Coverage
+        integer i;
+        integer px;
+        integer py;
+        reg [INT_SIZE - 1 : 0] e;
+
+        mask = { QUAD_PIXELS { 1'b1 } };
+        for (py = 0; py < QUAD_SIZE; py = py + 1)
+        begin
+            for (px = 0; px < QUAD_SIZE; px = px + 1)
+            begin
+                for (i = 0; i < 3; i = i + 1)
+                begin
+                    e = value[i * INT_SIZE +: INT_SIZE]
+                        + (stepX[i * INT_SIZE +: INT_SIZE] * px[0 +: INT_SIZE])
+                        + (stepY[i * INT_SIZE +: INT_SIZE] * py[0 +: INT_SIZE]);
+                    if (e[INT_SIZE - 1])
+                    begin
+                        mask[(py * QUAD_SIZE) + px] = 0;
+                    end
+                end
+            end
+        end
+    end
+
+    always @(posedge clk)
+    begin
+        if (!resetn)
+        begin
+            active <= 0;
+            outValid <= 0;
+        end
+        else
+        begin
+            if (load)
+            begin
+                active <= 1;
+                row <= slotStart;
+                value <= slotStart;
+                stepX <= slotStepX;
+                stepY <= slotStepY;
+                { tag, maxY, maxX } <= slotRegion;
+                x <= 0;
+                y <= 0;
+            end
+
+            if (advance)
+            begin : Step
+                integer i;
+
+                outValid <= active && (mask != 0);
+                outX <= x;
+                outY <= y;
+                outMask <= mask;
+                outTag <= tag;
+
+                if (active)
+                begin
+                    if (x == maxX)
+                    begin
+                        x <= 0;
+                        y <= y + 1;
+                        for (i = 0; i < 3; i = i + 1)
+                        begin
+                            row[i * INT_SIZE +: INT_SIZE] <= row[i * INT_SIZE +: INT_SIZE] + (stepY[i * INT_SIZE +: INT_SIZE] << QUAD_SIZE_LOG2);
+                            value[i * INT_SIZE +: INT_SIZE] <= row[i * INT_SIZE +: INT_SIZE] + (stepY[i * INT_SIZE +: INT_SIZE] << QUAD_SIZE_LOG2);
+                        end
+                        if (y == maxY)
+                        begin
+                            active <= 0;
+                        end
+                    end
+                    else
+                    begin
+                        x <= x + 1;
+                        for (i = 0; i < 3; i = i + 1)
+                        begin
+                            value[i * INT_SIZE +: INT_SIZE] <= value[i * INT_SIZE +: INT_SIZE] + (stepX[i * INT_SIZE +: INT_SIZE] << QUAD_SIZE_LOG2);
+                        end
+                    end
+                end
+            end
+        end
+    end
+endmodule
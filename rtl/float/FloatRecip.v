@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Floating point reciprocal
 // This is based on the paper: An Efficient Hardware Implementation for a Reciprocal Unit
 // See: https://www.researchgate.net/publication/220804890_An_Efficient_Hardware_Implementation_for_a_Reciprocal_Unit
@@ -31,7 +33,9 @@ module FloatRecip
     localparam SIGNED_MANZISSA_SIZE = MANTISSA_SIZE + 2, // S1.23
     localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
     localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1,
-    localparam EXPONENT_INF = (2 ** EXPONENT_SIZE) - 1
+    localparam EXPONENT_INF = (2 ** EXPONENT_SIZE) - 1,
+    localparam ITERATIONS = 2,
+    localparam LATENCY = `FLOAT_RECIP_LATENCY(ITERATIONS)
 )
 (
     input  wire                      clk,
@@ -57,17 +61,17 @@ module FloatRecip
     wire                                step1_sign;
     wire [SIGNED_MANZISSA_SIZE - 1 : 0] step1_mantissa;
 
-    ValueDelay #(.VALUE_SIZE(EXPONENT_SIZE), .DELAY(10)) 
+    ValueDelay #(.VALUE_SIZE(EXPONENT_SIZE), .DELAY(`COMPUTE_RECIP_LATENCY(ITERATIONS))) 
         step1exponent (.clk(clk), .ce(ce), .in(EXPONENT_BIAS - (step0_exp - EXPONENT_BIAS + 1)), .out(step1_exp));
 
-    ValueDelay #(.VALUE_SIZE(1), .DELAY(10)) 
+    ValueDelay #(.VALUE_SIZE(1), .DELAY(`COMPUTE_RECIP_LATENCY(ITERATIONS))) 
         step1sign (.clk(clk), .ce(ce), .in(step0_sign), .out(step1_sign));
 
     wire signed [SIGNED_MANZISSA_SIZE - 1 : 0]                              mt = { 1'b0, 1'b1, step0_mantissa[0 +: MANTISSA_SIZE] };
     wire        [(SIGNED_MANZISSA_SIZE - 1) + SIGNED_MANZISSA_SIZE - 1 : 0] step1_mantissa_big;
     ComputeRecip #(
         .MS(SIGNED_MANZISSA_SIZE),
-        .ITR(2)
+        .ITR(ITERATIONS)
     ) recip (
         .clk(clk),
         .ce(ce),
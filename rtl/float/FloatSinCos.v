@@ -0,0 +1,261 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point sin(x) and cos(x)
+// The argument is reduced in fixed point: The mantissa of x is multiplied with the constant
+// 2 / pi. The integer part of the product selects the quadrant, the fraction is the position
+// in the quadrant. sin and cos of the position are calculated with two FixedFunctions which
+// use tables of polynomials. TABLE_SIZE_LOG2 and DEGREE configure the accuracy and latency
+// (see FixedFunction). The results are converted with IntToFloat.
+// The argument reduction is accurate for |x| < 2 ** ARGUMENT_RANGE_LOG2. 
+// The error is an absolute error. Bounds for a float (s=1, e=8, m=23), the first two are
+// checked by the unit test:
+//  - TABLE_SIZE_LOG2 = 8, DEGREE = 2: < 2 ** -22
+//  - TABLE_SIZE_LOG2 = 5, DEGREE = 3: < 2 ** -21
+//  - TABLE_SIZE_LOG2 = 7, DEGREE = 1: < 2 ** -13
+// For very small x, sin(x) is x and cos(x) is 1.0. sin and cos of Inf and NaN are NaN.
+// This module is pipelined. It can calculate one sin(x) and cos(x) per clock
+// This module has a latency of DEGREE + 9 clock cycles
+module FloatSinCos
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter TABLE_SIZE_LOG2 = 8,
+    parameter DEGREE = 2,
+    parameter GUARD_SIZE = 6,
+    parameter ARGUMENT_RANGE_LOG2 = 8,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_SIN_COS_LATENCY(DEGREE)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    in,
+    output reg  [FLOAT_SIZE - 1 : 0]    sin,
+    output reg  [FLOAT_SIZE - 1 : 0]    cos
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+    localparam EXPONENT_BIAS = (2 ** (EXPONENT_SIZE - 1)) - 1;
+    localparam EXPONENT_MAX = (2 ** EXPONENT_SIZE) - 1; // Inf and NaN
+    localparam EXPONENT_CALC_SIZE = EXPONENT_SIZE + 2;
+
+    localparam FRACTION_SIZE = MANTISSA_SIZE + GUARD_SIZE;
+    localparam FIXED_SIZE = 2 + FRACTION_SIZE; // Quadrant and position in the quadrant
+    localparam VALUE_SIZE = FRACTION_SIZE + 3; // See FixedFunction
+    localparam CONSTANT_SIZE = FIXED_SIZE + ARGUMENT_RANGE_LOG2;
+    localparam PROD_SIZE = MANTISSA_SIZE + 1 + CONSTANT_SIZE;
+    localparam PROD_SHIFT = MANTISSA_SIZE + CONSTANT_SIZE - FRACTION_SIZE;
+    // sin(x) = x when x * x / 6 is smaller than the precision of the mantissa
+    localparam SMALL_EXPONENT = EXPONENT_BIAS - (MANTISSA_SIZE / 2) - 1;
+    localparam signed [EXPONENT_SIZE - 1 : 0] INT_TO_FLOAT_OFFSET = -FRACTION_SIZE;
+    localparam FLAGS_SIZE = FLOAT_SIZE + 2;
+
+    // 2 / pi with 128 fraction bits
+    localparam [127 : 0] TWO_BY_PI = 128'ha2f9836e4e441529fc2757d1f534ddc0;
+    localparam [CONSTANT_SIZE - 1 : 0] TWO_BY_PI_FIXED = TWO_BY_PI[128 - CONSTANT_SIZE +: CONSTANT_SIZE] 
+        + { { (CONSTANT_SIZE - 1) { 1'b0 } }, TWO_BY_PI[127 - CONSTANT_SIZE] };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Multiply the mantissa with 2 / pi
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [PROD_SIZE - 1 : 0]        one_prod;
+    reg  [EXPONENT_SIZE - 1 : 0]    one_exponent;
+    reg                             one_sign;
+    always @(posedge clk)
+    if (ce) begin
+        one_prod <= { in[EXPONENT_POS +: EXPONENT_SIZE] != 0, in[MANTISSA_POS +: MANTISSA_SIZE] } * TWO_BY_PI_FIXED;
+        one_exponent <= in[EXPONENT_POS +: EXPONENT_SIZE];
+        one_sign <= in[SIGN_POS];
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Extract the quadrant and the position in the quadrant
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [1 : 0]                    two_quadrant;
+    reg  [FRACTION_SIZE - 1 : 0]    two_fraction;
+    reg                             two_sign;
+    always @(posedge clk)
+    if (ce) begin : Reduce
+        reg signed [EXPONENT_CALC_SIZE - 1 : 0] shift;
+        reg        [PROD_SIZE - 1 : 0]          prod;
+
+        // Only the two lowest bits of the integer part are required (modulo 2 * pi)
+        shift = $signed({ 2'b0, one_exponent }) - EXPONENT_BIAS[0 +: EXPONENT_CALC_SIZE];
+        shift = PROD_SHIFT[0 +: EXPONENT_CALC_SIZE] - shift;
+        if (shift >= 0)
+        begin
+            prod = one_prod >> shift;
+        end
+        else
+        begin
+            prod = one_prod << (-shift);
+        end
+        two_quadrant <= prod[FRACTION_SIZE +: 2];
+        two_fraction <= prod[0 +: FRACTION_SIZE];
+        two_sign <= one_sign;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Calculate sin and cos of the position in the quadrant
+    // Clocks: FIXED_FUNCTION_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [VALUE_SIZE - 1 : 0]   sinFraction;
+    wire [VALUE_SIZE - 1 : 0]   cosFraction;
+    wire [1 : 0]                quadrantDelayed;
+    wire                        signDelayed;
+
+    FixedFunction #(
+        .FUNCTION("SIN"),
+        .X_SIZE(FRACTION_SIZE),
+        .TABLE_SIZE_LOG2(TABLE_SIZE_LOG2),
+        .DEGREE(DEGREE),
+        .FRACTION_SIZE(FRACTION_SIZE)
+    ) sinFunction (
+        .clk(clk),
+        .ce(ce),
+        .x(two_fraction),
+        .y(sinFraction)
+    );
+
+    FixedFunction #(
+        .FUNCTION("COS"),
+        .X_SIZE(FRACTION_SIZE),
+        .TABLE_SIZE_LOG2(TABLE_SIZE_LOG2),
+        .DEGREE(DEGREE),
+        .FRACTION_SIZE(FRACTION_SIZE)
+    ) cosFunction (
+        .clk(clk),
+        .ce(ce),
+        .x(two_fraction),
+        .y(cosFraction)
+    );
+
+    ValueDelay #(.VALUE_SIZE(3), .DELAY(`FIXED_FUNCTION_LATENCY(DEGREE))) 
+        quadrantDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ two_quadrant, two_sign }), 
+            .out({ quadrantDelayed, signDelayed })
+        );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Map the results to the quadrant
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [VALUE_SIZE - 1 : 0]   three_sin;
+    reg  [VALUE_SIZE - 1 : 0]   three_cos;
+    always @(posedge clk)
+    if (ce) begin : Quadrant
+        reg  [VALUE_SIZE - 1 : 0] s;
+        reg  [VALUE_SIZE - 1 : 0] c;
+
+        case (quadrantDelayed)
+            2'd0:
+            begin
+                s = sinFraction;
+                c = cosFraction;
+            end
+            2'd1:
+            begin
+                s = cosFraction;
+                c = ~sinFraction + 1;
+            end
+            2'd2:
+            begin
+                s = ~sinFraction + 1;
+                c = ~cosFraction + 1;
+            end
+            default:
+            begin
+                s = ~cosFraction + 1;
+                c = sinFraction;
+            end
+        endcase
+
+        // sin(-x) = -sin(x)
+        if (signDelayed)
+        begin
+            s = ~s + 1;
+        end
+        three_sin <= s;
+        three_cos <= c;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 4
+    // Convert the results into floats
+    // Clocks: INT_TO_FLOAT_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]   sinFloat;
+    wire [FLOAT_SIZE - 1 : 0]   cosFloat;
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE))
+        sinToFloat (.clk(clk), .ce(ce), .offset(INT_TO_FLOAT_OFFSET), .in(three_sin), .out(sinFloat));
+
+    IntToFloat #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .INT_SIZE(VALUE_SIZE))
+        cosToFloat (.clk(clk), .ce(ce), .offset(INT_TO_FLOAT_OFFSET), .in(three_cos), .out(cosFloat));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 5
+    // Handle small numbers, Inf and NaN
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]   inDelayed;
+    wire                        smallDelayed;
+    wire                        specialDelayed;
+
+    ValueDelay #(.VALUE_SIZE(FLAGS_SIZE), .DELAY(LATENCY - 1)) 
+        flagsDelay (
+            .clk(clk), 
+            .ce(ce), 
+            .in({ 
+                in, 
+                in[EXPONENT_POS +: EXPONENT_SIZE] < SMALL_EXPONENT[0 +: EXPONENT_SIZE], 
+                in[EXPONENT_POS +: EXPONENT_SIZE] == EXPONENT_MAX[0 +: EXPONENT_SIZE]
+            }), 
+            .out({ inDelayed, smallDelayed, specialDelayed })
+        );
+
+    always @(posedge clk)
+    if (ce) begin
+        if (specialDelayed)
+        begin
+            sin <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+            cos <= { 1'b0, EXPONENT_MAX[0 +: EXPONENT_SIZE], { MANTISSA_SIZE { 1'b1 } } };
+        end
+        else if (smallDelayed)
+        begin
+            sin <= inDelayed;
+            cos <= { 2'b0, { (EXPONENT_SIZE - 1) { 1'b1 } }, { MANTISSA_SIZE { 1'b0 } } }; // 1.0
+        end
+        else
+        begin
+            sin <= sinFloat;
+            cos <= cosFloat;
+        end
+    end
+endmodule
@@ -0,0 +1,151 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point square (x * x)
+// A square requires only around half of the partial products of a multiplication, because
+// x[i] * x[j] and x[j] * x[i] are the same and x[i] * x[i] is x[i]. The partial products
+// are folded into one row per bit of the mantissa:
+// row[i] = x[i] * (2 ** (2 * i) + sum(x[j] * 2 ** (i + j + 1)) for j > i)
+// The rows are implemented without DSPs. They are split into groups which are summed up in the
+// first step and added together in the second step (like the FloatMulConst).
+// The sign of the result is always positive.
+// The results are bit exact to the results of the FloatMul.
+// This module is pipelined. It can calculate one square per clock
+// This module has a latency of 3 clock cycles minimum
+module FloatSquare
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter DELAY = 1, // Use this delay to add clock cycles. It adds by default 1 clock cycle, so that the square has the same latency as the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_SQUARE_LATENCY(DELAY)
+)
+(
+    input  wire                      clk,
+    input  wire                      ce,
+    input  wire [FLOAT_SIZE - 1 : 0] in,
+    output wire [FLOAT_SIZE - 1 : 0] square
+);
+    localparam MANTISSA_CALC_SIZE = MANTISSA_SIZE + 1; // Add hidden bit
+    localparam MANTISSA_PROD_SIZE = MANTISSA_CALC_SIZE * 2;
+    localparam FLAGS_SIZE = 1 + EXPONENT_SIZE + 1 + 1 + 1; // Sign, exponent, underflow, overflow, normalization required
+    localparam GROUPS = 4;
+    localparam GROUP_SIZE = (MANTISSA_CALC_SIZE + GROUPS - 1) / GROUPS;
+    localparam [MANTISSA_PROD_SIZE - 1 : 0] ONE = 1;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Unpack, sign and exponent.
+    // Clocks: 0
+    ////////////////////////////////////////////////////////////////////////////
+    wire [MANTISSA_CALC_SIZE - 1 : 0]   step0_mantissa;
+    wire [FLAGS_SIZE - 1 : 0]           step0_flags;
+    wire [FLAGS_SIZE - 1 : 0]           step2_flags;
+
+    FloatMulUnpack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        unpack (
+            .facAIn(in),
+            .facBIn(in),
+            .facAMantissa(step0_mantissa),
+            .facBMantissa(),
+            .sign(step0_flags[FLAGS_SIZE - 1]),
+            .exponentSum(step0_flags[3 +: EXPONENT_SIZE]),
+            .exponentUnderflow(step0_flags[2]),
+            .exponentOverflow(step0_flags[1]),
+            .normalizationRequired(step0_flags[0])
+        );
+
+    ValueDelay #(.VALUE_SIZE(FLAGS_SIZE), .DELAY(2)) 
+        flagsDelay (.clk(clk), .ce(ce), .in(step0_flags), .out(step2_flags));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Sum up the rows of each group
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    (* use_dsp = "no" *) reg  [MANTISSA_PROD_SIZE - 1 : 0] one_groupSum [0 : GROUPS - 1];
+    always @(posedge clk)
+    if (ce) begin : GroupSum
+        reg  [MANTISSA_PROD_SIZE - 1 : 0]   groupSum;
+        reg  [MANTISSA_PROD_SIZE - 1 : 0]   mantissa;
+        integer                             i;
+        integer                             j;
+
+        mantissa = { { (MANTISSA_PROD_SIZE - MANTISSA_CALC_SIZE) { 1'b0 } }, step0_mantissa };
+        for (i = 0; i < GROUPS; i = i + 1)
+        begin
+            groupSum = 0;
+            for (j = i * GROUP_SIZE; (j < ((i + 1) * GROUP_SIZE)) && (j < MANTISSA_CALC_SIZE); j = j + 1)
+            begin
+                if (mantissa[j])
+                begin
+                    // x[j] * x[j] and the doubled products with all higher bits
+                    groupSum = groupSum + (((mantissa >> (j + 1)) << ((2 * j) + 2)) | (ONE << (2 * j)));
+                end
+            end
+            one_groupSum[i] <= groupSum;
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Add the groups
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [MANTISSA_PROD_SIZE - 1 : 0]   two_mantissaProd;
+    always @(posedge clk)
+    if (ce) begin : Sum
+        reg  [MANTISSA_PROD_SIZE - 1 : 0] sum;
+        integer                           i;
+
+        sum = 0;
+        for (i = 0; i < GROUPS; i = i + 1)
+        begin
+            sum = sum + one_groupSum[i];
+        end
+        two_mantissaProd <= sum;
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 3
+    // Normalize and pack
+    // Clocks: 1
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]           step3_square;
+    reg  [FLOAT_SIZE - 1 : 0]           squareReg;
+
+    FloatMulPack #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        pack (
+            .mantissaProd(two_mantissaProd),
+            .sign(step2_flags[FLAGS_SIZE - 1]),
+            .exponentSum(step2_flags[3 +: EXPONENT_SIZE]),
+            .exponentUnderflow(step2_flags[2]),
+            .exponentOverflow(step2_flags[1]),
+            .normalizationRequired(step2_flags[0]),
+            .prod(step3_square)
+        );
+
+    always @(posedge clk)
+    if (ce) begin
+        squareReg <= step3_square;
+    end
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
+        squareDelay (.clk(clk), .ce(ce), .in(squareReg), .out(square));
+endmodule
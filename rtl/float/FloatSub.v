@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Floating point substraction
 // This module is pipelined. It can calculate one substraction per clock
 // This module has a latency of 4 clock cycles
@@ -23,7 +25,8 @@ module FloatSub
     parameter MANTISSA_SIZE = 23,
     parameter EXPONENT_SIZE = 8,
     parameter ENABLE_OPTIMIZATION = 0,
-    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_SUB_LATENCY
 )
 (
     input  wire                      clk,
@@ -0,0 +1,45 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Floating point substraction in the unpacked format (see FloatUnpack)
+// This module is pipelined. It can calculate one substraction per clock
+// This module has a latency of 3 clock cycles
+module FloatSubUnpacked
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    localparam UNPACKED_EXPONENT_SIZE = EXPONENT_SIZE + 2,
+    localparam UNPACKED_MANTISSA_SIZE = 2 + MANTISSA_SIZE + GUARD_SIZE,
+    localparam UNPACKED_SIZE = 1 + UNPACKED_EXPONENT_SIZE + UNPACKED_MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_SUB_UNPACKED_LATENCY
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [UNPACKED_SIZE - 1 : 0] aIn,
+    input  wire [UNPACKED_SIZE - 1 : 0] bIn,
+    output wire [UNPACKED_SIZE - 1 : 0] sum
+);
+    localparam SIGN_POS = UNPACKED_SIZE - 1;
+
+    wire [UNPACKED_SIZE - 1 : 0] comp;
+    assign comp = {~bIn[SIGN_POS], bIn[SIGN_POS - 1 : 0]};
+    FloatAddUnpacked #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .GUARD_SIZE(GUARD_SIZE)) add(clk, ce, aIn, comp, sum);
+endmodule
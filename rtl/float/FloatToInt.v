@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Float to signed integer conversion
 // This module is pipelined. It can calculate one conversion per clock
 // This module has a latency of 2 clock cycles minimum
@@ -30,7 +32,8 @@ module FloatToInt
     // Use this delay to add clock cycles. It adds by default 2 clock cycles, so that the conversion requieres 4 clocks.
     parameter DELAY = 2,
 
-    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_TO_INT_LATENCY(DELAY)
 )
 (
     input  wire                                 clk,
@@ -98,7 +101,7 @@ module FloatToInt
         end
     end
 
-    reg [FLOAT_SIZE - 1 : 0] two_out;
+    reg [INT_SIZE - 1 : 0] two_out;
     always @(posedge clk)
     if (ce) begin : Pack
         reg                     underflow;
@@ -145,6 +148,6 @@ module FloatToInt
         end
     end
 
-    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(DELAY)) 
+    ValueDelay #(.VALUE_SIZE(INT_SIZE), .DELAY(DELAY)) 
         currentIterationDelayer (.clk(clk), .ce(ce), .in(two_out), .out(out));
 endmodule
\ No newline at end of file
@@ -0,0 +1,95 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Converts a float into the unpacked format which is used by the *Unpacked modules.
+// The unpacked format avoids that every module in a chain of operations has to unpack
+// its operands and pack its result again. Use FloatPack to convert it back into a float.
+// The unpacked format is { sign, exponent, mantissa }:
+//  - sign: 1 bit
+//  - exponent: Signed number with EXPONENT_SIZE + 2 bits. It uses the same bias as the float.
+//    It is not limited to the range of the float, so it can't overflow in a chain of operations.
+//  - mantissa: Unsigned fixed point number with an explicit hidden bit. It has 2 integer bits,
+//    MANTISSA_SIZE fraction bits and GUARD_SIZE additional fraction bits to reduce the rounding
+//    error in a chain of operations. A number is normalized to a range of 1.0 to 3.999.., a
+//    zero has a mantissa of zero and the lowest possible exponent. Denormalized floats are
+//    normalized, inf and NaN are represented by an exponent which is bigger than the maximum exponent.
+// GUARD_SIZE must be at least 1 and must be the same for all modules in a chain.
+// This module is pipelined. It can unpack one float per clock
+// This module has a latency of 1 clock cycle
+module FloatUnpack
+# (
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter GUARD_SIZE = 2,
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam UNPACKED_EXPONENT_SIZE = EXPONENT_SIZE + 2,
+    localparam UNPACKED_MANTISSA_SIZE = 2 + MANTISSA_SIZE + GUARD_SIZE,
+    localparam UNPACKED_SIZE = 1 + UNPACKED_EXPONENT_SIZE + UNPACKED_MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_UNPACK_LATENCY
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+    input  wire [FLOAT_SIZE - 1 : 0]    in,
+    output reg  [UNPACKED_SIZE - 1 : 0] out
+);
+    localparam MANTISSA_POS = 0;
+    localparam EXPONENT_POS = MANTISSA_SIZE;
+    localparam SIGN_POS = EXPONENT_POS + EXPONENT_SIZE;
+
+    localparam SHIFT_SIZE = $clog2(MANTISSA_SIZE) + 1;
+    localparam [UNPACKED_EXPONENT_SIZE - 1 : 0] UNPACKED_EXPONENT_MIN = { 1'b1, { (UNPACKED_EXPONENT_SIZE - 1) { 1'b0 } } };
+
+    wire [SHIFT_SIZE - 1 : 0] leadingOne;
+    FindExponent #(.EXPONENT_SIZE(SHIFT_SIZE), .VALUE_SIZE(MANTISSA_SIZE)) findExponent (in[MANTISSA_POS +: MANTISSA_SIZE], leadingOne);
+
+    always @(posedge clk)
+    if (ce) begin : Unpack
+        reg  [EXPONENT_SIZE - 1 : 0]            exponent;
+        reg  [MANTISSA_SIZE - 1 : 0]            fraction;
+        reg  [SHIFT_SIZE - 1 : 0]               shift;
+        reg  [UNPACKED_EXPONENT_SIZE - 1 : 0]   unpackedExponent;
+        reg  [UNPACKED_MANTISSA_SIZE - 1 : 0]   unpackedMantissa;
+
+        exponent = in[EXPONENT_POS +: EXPONENT_SIZE];
+        fraction = in[MANTISSA_POS +: MANTISSA_SIZE];
+
+        if (exponent != 0)
+        begin
+            // Normalized number: Just add the hidden bit
+            unpackedExponent = { 2'b00, exponent };
+            unpackedMantissa = { 2'b01, fraction, { GUARD_SIZE { 1'b0 } } };
+        end
+        else if (fraction != 0)
+        begin
+            // Denormalized number: Shift the leading one to the position of the hidden bit
+            shift = MANTISSA_SIZE[0 +: SHIFT_SIZE] - leadingOne;
+            unpackedExponent = { { (UNPACKED_EXPONENT_SIZE - 1) { 1'b0 } }, 1'b1 } - { { (UNPACKED_EXPONENT_SIZE - SHIFT_SIZE) { 1'b0 } }, shift };
+            unpackedMantissa = { 2'b00, fraction, { GUARD_SIZE { 1'b0 } } } << shift;
+        end
+        else
+        begin
+            // Zero
+            unpackedExponent = UNPACKED_EXPONENT_MIN;
+            unpackedMantissa = 0;
+        end
+
+        out <= { in[SIGN_POS], unpackedExponent, unpackedMantissa };
+    end
+endmodule
@@ -0,0 +1,149 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Transforms a vertex with a 4x4 matrix and divides x, y and z by w (perspective divide):
+// (x', y', z', w') = M * (x, y, z, w)
+// (outX, outY, outZ) = (x', y', z') / w', outInvW = 1 / w'
+// Every row of the matrix has a dot product lane with four FloatMuls and a tree of three FloatAdds.
+// 1 / w' is calculated with a FloatRecip. x', y' and z' are delayed with ValueDelays until the
+// reciprocal is ready and are then multiplied with it.
+// The matrix is stored in registers and loaded with 'matrixWe'. 'matrixAddr' is the index of the
+// element (row * 4 + column). After the configuration, the matrix is the identity. The new element
+// is used immediately, the vertices in the pipeline are not affected.
+// This module is pipelined. It can transform one vertex per clock
+// This module has a latency of 8 + (2 * (2 + MUL_DELAY)) + 11 clock cycles
+module FloatVertexTransform
+#(
+    parameter MANTISSA_SIZE = 23,
+    parameter EXPONENT_SIZE = 8,
+    parameter MUL_DELAY = 2, // DELAY of the FloatMul
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `FLOAT_VERTEX_TRANSFORM_LATENCY(MUL_DELAY)
+)
+(
+    input  wire                         clk,
+    input  wire                         ce,
+
+    input  wire                         matrixWe,
+    input  wire [3 : 0]                 matrixAddr,
+    input  wire [FLOAT_SIZE - 1 : 0]    matrixIn,
+
+    input  wire [FLOAT_SIZE - 1 : 0]    inX,
+    input  wire [FLOAT_SIZE - 1 : 0]    inY,
+    input  wire [FLOAT_SIZE - 1 : 0]    inZ,
+    input  wire [FLOAT_SIZE - 1 : 0]    inW,
+
+    output wire [FLOAT_SIZE - 1 : 0]    outX,
+    output wire [FLOAT_SIZE - 1 : 0]    outY,
+    output wire [FLOAT_SIZE - 1 : 0]    outZ,
+    output wire [FLOAT_SIZE - 1 : 0]    outInvW
+);
+    localparam MUL_LATENCY = `FLOAT_MUL_LATENCY(MUL_DELAY);
+    localparam RECIP_LATENCY = `FLOAT_RECIP_LATENCY(2);
+    localparam [FLOAT_SIZE - 1 : 0] ONE = { 2'b00, { (EXPONENT_SIZE - 1) { 1'b1 } }, { MANTISSA_SIZE { 1'b0 } } };
+    localparam [FLOAT_SIZE - 1 : 0] ZERO = 0;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Matrix
+    ////////////////////////////////////////////////////////////////////////////
+    reg  [(16 * FLOAT_SIZE) - 1 : 0] matrix = {
+        ONE,  ZERO, ZERO, ZERO,
+        ZERO, ONE,  ZERO, ZERO,
+        ZERO, ZERO, ONE,  ZERO,
+        ZERO, ZERO, ZERO, ONE
+    };
+    always @(posedge clk)
+    begin
+        if (matrixWe)
+        begin
+            matrix[matrixAddr * FLOAT_SIZE +: FLOAT_SIZE] <= matrixIn;
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 0
+    // Dot products of the rows with the vertex
+    // Clocks: FLOAT_MUL_LATENCY + (2 * FLOAT_ADD_LATENCY)
+    ////////////////////////////////////////////////////////////////////////////
+    wire [(4 * FLOAT_SIZE) - 1 : 0] vertex = { inW, inZ, inY, inX };
+    wire [(4 * FLOAT_SIZE) - 1 : 0] transformed;
+
+    generate
+        genvar r;
+        genvar c;
+        for (r = 0; r < 4; r = r + 1)
+        begin : Row
+            wire [(4 * FLOAT_SIZE) - 1 : 0] prods;
+            wire [FLOAT_SIZE - 1 : 0]       sum01;
+            wire [FLOAT_SIZE - 1 : 0]       sum23;
+
+            for (c = 0; c < 4; c = c + 1)
+            begin : Column
+                FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+                    mul (
+                        .clk(clk), 
+                        .ce(ce), 
+                        .facAIn(matrix[((r * 4) + c) * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .facBIn(vertex[c * FLOAT_SIZE +: FLOAT_SIZE]), 
+                        .prod(prods[c * FLOAT_SIZE +: FLOAT_SIZE])
+                    );
+            end
+
+            FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                add01 (.clk(clk), .ce(ce), .aIn(prods[0 * FLOAT_SIZE +: FLOAT_SIZE]), .bIn(prods[1 * FLOAT_SIZE +: FLOAT_SIZE]), .sum(sum01));
+
+            FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                add23 (.clk(clk), .ce(ce), .aIn(prods[2 * FLOAT_SIZE +: FLOAT_SIZE]), .bIn(prods[3 * FLOAT_SIZE +: FLOAT_SIZE]), .sum(sum23));
+
+            FloatAdd #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+                add (.clk(clk), .ce(ce), .aIn(sum01), .bIn(sum23), .sum(transformed[r * FLOAT_SIZE +: FLOAT_SIZE]));
+        end
+    endgenerate
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 1
+    // Reciprocal of w
+    // Clocks: FLOAT_RECIP_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    wire [FLOAT_SIZE - 1 : 0]       invW;
+    wire [(3 * FLOAT_SIZE) - 1 : 0] xyz;
+
+    FloatRecip #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE))
+        wRecip (.clk(clk), .ce(ce), .in(transformed[3 * FLOAT_SIZE +: FLOAT_SIZE]), .out(invW));
+
+    ValueDelay #(.VALUE_SIZE(3 * FLOAT_SIZE), .DELAY(RECIP_LATENCY)) 
+        xyzDelay (.clk(clk), .ce(ce), .in(transformed[0 +: 3 * FLOAT_SIZE]), .out(xyz));
+
+    ////////////////////////////////////////////////////////////////////////////
+    // STEP 2
+    // Perspective divide
+    // Clocks: FLOAT_MUL_LATENCY
+    ////////////////////////////////////////////////////////////////////////////
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+        xMul (.clk(clk), .ce(ce), .facAIn(xyz[0 * FLOAT_SIZE +: FLOAT_SIZE]), .facBIn(invW), .prod(outX));
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+        yMul (.clk(clk), .ce(ce), .facAIn(xyz[1 * FLOAT_SIZE +: FLOAT_SIZE]), .facBIn(invW), .prod(outY));
+
+    FloatMul #(.MANTISSA_SIZE(MANTISSA_SIZE), .EXPONENT_SIZE(EXPONENT_SIZE), .DELAY(MUL_DELAY))
+        zMul (.clk(clk), .ce(ce), .facAIn(xyz[2 * FLOAT_SIZE +: FLOAT_SIZE]), .facBIn(invW), .prod(outZ));
+
+    ValueDelay #(.VALUE_SIZE(FLOAT_SIZE), .DELAY(MUL_LATENCY)) 
+        invWDelay (.clk(clk), .ce(ce), .in(invW), .out(outInvW));
+endmodule
@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Signed integer to float conversion
 // This module is pipelined. It can calculate one conversion per clock
 // This module has a latency of 4 clock cycles
@@ -25,7 +27,8 @@ module IntToFloat
 
     parameter INT_SIZE = 32, 
 
-    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE
+    localparam FLOAT_SIZE = 1 + EXPONENT_SIZE + MANTISSA_SIZE,
+    localparam LATENCY = `INT_TO_FLOAT_LATENCY
 )
 (
     input  wire                                 clk,
@@ -0,0 +1,148 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Asynchronous first word fall through FIFO to transfer values between two clock domains.
+// The read and write pointers are exchanged as gray code via two synchronization flip flops.
+// Because of the synchronization, 'full' and 'wrFill' in the write domain and 'outValid'
+// in the read domain are pessimistic. They are updated a few clocks after the other
+// domain has changed the FIFO.
+// The memory is read asynchronously, so that it can be mapped into distributed RAM.
+// The FIFO has a depth of 2 ** ADDR_SIZE values. ADDR_SIZE must be at least 2.
+module ValueAsyncFifo
+#(
+    parameter VALUE_SIZE = 32,
+    parameter ADDR_SIZE = 4,
+    localparam DEPTH = 2 ** ADDR_SIZE,
+    localparam PTR_SIZE = ADDR_SIZE + 1 // Additional bit to distinguish between full and empty
+)
+(
+    // Write domain
+    input  wire                         wrClk,
+    input  wire                         wrResetn,
+    input  wire                         inValid,
+    output wire                         inReady,
+    input  wire [VALUE_SIZE - 1 : 0]    in,
+    output wire [PTR_SIZE - 1 : 0]      wrFill,
+
+    // Read domain
+    input  wire                         rdClk,
+    input  wire                         rdResetn,
+    output wire                         outValid,
+    input  wire                         outReady,
+    output wire [VALUE_SIZE - 1 : 0]    out
+);
+    function [PTR_SIZE - 1 : 0] binToGray;
+        input [PTR_SIZE - 1 : 0] bin;
+        begin
+            binToGray = bin ^ (bin >> 1);
+        end
+    endfunction
+
+    function [PTR_SIZE - 1 : 0] grayToBin;
+        input [PTR_SIZE - 1 : 0] gray;
+        integer i;
+        begin
+            grayToBin[PTR_SIZE - 1] = gray[PTR_SIZE - 1];
+            for (i = PTR_SIZE - 2; i >= 0; i = i - 1)
+            begin
+                grayToBin[i] = grayToBin[i + 1] ^ gray[i];
+            end
+        end
+    endfunction
+
+    (* ram_style = "distributed" *) reg [VALUE_SIZE - 1 : 0] ram [0 : DEPTH - 1];
+
+    reg  [PTR_SIZE - 1 : 0] wrBin = 0;
+    reg  [PTR_SIZE - 1 : 0] wrGray = 0;
+    (* ASYNC_REG = "TRUE" *) reg [PTR_SIZE - 1 : 0] wrRdGraySync0 = 0;
+    (* ASYNC_REG = "TRUE" *) reg [PTR_SIZE - 1 : 0] wrRdGraySync1 = 0;
+
+    reg  [PTR_SIZE - 1 : 0] rdBin = 0;
+    reg  [PTR_SIZE - 1 : 0] rdGray = 0;
+    (* ASYNC_REG = "TRUE" *) reg [PTR_SIZE - 1 : 0] rdWrGraySync0 = 0;
+    (* ASYNC_REG = "TRUE" *) reg [PTR_SIZE - 1 : 0] rdWrGraySync1 = 0;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Write domain
+    ////////////////////////////////////////////////////////////////////////////
+    wire [PTR_SIZE - 1 : 0] wrRdBin = grayToBin(wrRdGraySync1);
+    // The FIFO is full, when the write pointer is exactly one round ahead of the read pointer
+    wire                    wrFull = wrGray == { ~wrRdGraySync1[PTR_SIZE - 1 -: 2], wrRdGraySync1[0 +: PTR_SIZE - 2] };
+    wire                    write = inValid && !wrFull;
+
+    assign inReady = !wrFull;
+    assign wrFill = wrBin - wrRdBin;
+
+    always @(posedge wrClk)
+    begin
+        if (write)
+        begin
+            ram[wrBin[0 +: ADDR_SIZE]] <= in;
+        end
+    end
+
+    always @(posedge wrClk)
+    begin
+        if (!wrResetn)
+        begin
+            wrBin <= 0;
+            wrGray <= 0;
+            wrRdGraySync0 <= 0;
+            wrRdGraySync1 <= 0;
+        end
+        else
+        begin : WritePointer
+            reg [PTR_SIZE - 1 : 0] wrBinNext;
+
+            wrBinNext = wrBin + { { (PTR_SIZE - 1) { 1'b0 } }, write };
+            wrBin <= wrBinNext;
+            wrGray <= binToGray(wrBinNext);
+            wrRdGraySync0 <= rdGray;
+            wrRdGraySync1 <= wrRdGraySync0;
+        end
+    end
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Read domain
+    ////////////////////////////////////////////////////////////////////////////
+    wire                    rdEmpty = rdGray == rdWrGraySync1;
+    wire                    read = outReady && !rdEmpty;
+
+    assign outValid = !rdEmpty;
+    assign out = ram[rdBin[0 +: ADDR_SIZE]];
+
+    always @(posedge rdClk)
+    begin
+        if (!rdResetn)
+        begin
+            rdBin <= 0;
+            rdGray <= 0;
+            rdWrGraySync0 <= 0;
+            rdWrGraySync1 <= 0;
+        end
+        else
+        begin : ReadPointer
+            reg [PTR_SIZE - 1 : 0] rdBinNext;
+
+            rdBinNext = rdBin + { { (PTR_SIZE - 1) { 1'b0 } }, read };
+            rdBin <= rdBinNext;
+            rdGray <= binToGray(rdBinNext);
+            rdWrGraySync0 <= wrGray;
+            rdWrGraySync1 <= rdWrGraySync0;
+        end
+    end
+endmodule
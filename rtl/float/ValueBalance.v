@@ -0,0 +1,48 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+`include "FloatLatency.vh"
+
+// Aligns two branches of a datapath. A_LATENCY and B_LATENCY are the latencies
+// which the values in 'aIn' and 'bIn' already have (relative to a common point
+// in the datapath, for instance the input of a module). The branch with the
+// smaller latency is delayed via a ValueDelay so that both values leave this
+// module with a latency of max(A_LATENCY, B_LATENCY).
+// Example: To align an operand with the result of a FloatMul, use
+// A_LATENCY = 0 for the operand and B_LATENCY = `FLOAT_MUL_LATENCY(DELAY) for the product.
+// This module is pipelined
+module ValueBalance #(
+    parameter A_SIZE = 32,
+    parameter B_SIZE = 32,
+    parameter A_LATENCY = 0,
+    parameter B_LATENCY = 0,
+    localparam LATENCY = (A_LATENCY > B_LATENCY) ? A_LATENCY : B_LATENCY
+)
+(
+    input  wire                  clk,
+    input  wire                  ce,
+    input  wire [A_SIZE - 1 : 0] aIn,
+    input  wire [B_SIZE - 1 : 0] bIn,
+    output wire [A_SIZE - 1 : 0] aOut,
+    output wire [B_SIZE - 1 : 0] bOut
+);
+    ValueDelay #(.VALUE_SIZE(A_SIZE), .DELAY(LATENCY - A_LATENCY))
+        aDelay (.clk(clk), .ce(ce), .in(aIn), .out(aOut));
+
+    ValueDelay #(.VALUE_SIZE(B_SIZE), .DELAY(LATENCY - B_LATENCY))
+        bDelay (.clk(clk), .ce(ce), .in(bIn), .out(bOut));
+endmodule
@@ -0,0 +1,91 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// This module implements a credit based flow control for a pipeline which
+// writes its results into a FIFO (for instance a ValueFifo).
+// It works like the ValueTrack, but instead of counting the values in the
+// pipeline, it counts the free entries (credits) of the FIFO.
+// Every value which is issued into the pipeline ('sigIncomingValue') consumes a
+// credit. Every value which is drained from the FIFO ('sigOutgoingValue') returns
+// a credit. When CREDITS is equal to the depth of the FIFO, the FIFO can never
+// overflow. The pipeline itself never has to be stalled, because every value
+// in the pipeline already has a reserved entry in the FIFO.
+// A value must only be issued while 'creditAvailable' is set. An issue without
+// a credit is ignored (the counter saturates at zero), but the value has no
+// reserved entry and can overflow the FIFO.
+// A reset returns all credits. The pipeline must be empty after the reset, for
+// instance by holding 'resetn' at least for the latency of the pipeline.
+// 'almostFull' is a registered signal which is set when the available credits are
+// less or equal than ALMOST_FULL_THRESHOLD. A producer which requires N clocks to
+// react on 'almostFull' can issue one value per clock when the threshold is at
+// least N. This avoids a combinatorial ready path from the consumer to the producer.
+// This module is pipelined
+module ValueCredit
+#(
+    parameter CREDITS = 16, // Depth of the downstream FIFO
+    parameter CREDIT_SIZE = $clog2(CREDITS + 1), // Size of the credit counter
+    parameter ALMOST_FULL_THRESHOLD = 1
+)
+(
+    input  wire                         aclk,
+    input  wire                         resetn,
+
+    input  wire                         sigIncomingValue,
+    input  wire                         sigOutgoingValue,
+    output reg  [CREDIT_SIZE - 1 : 0]   credits = CREDITS[0 +: CREDIT_SIZE],
+    output reg                          creditAvailable = CREDITS != 0,
+    output reg                          almostFull = CREDITS <= ALMOST_FULL_THRESHOLD,
+    output reg                          valueInPipeline = 0
+);
+    always @(posedge aclk)
+    begin
+        if (!resetn)
+        begin
+            credits <= CREDITS[0 +: CREDIT_SIZE];
+            creditAvailable <= CREDITS != 0;
+            almostFull <= CREDITS <= ALMOST_FULL_THRESHOLD;
+            valueInPipeline <= 0;
+        end
+        else
+        begin : Update
+            reg [CREDIT_SIZE - 1 : 0] creditsNext;
+            reg                       consume;
+
+            // An issue without a credit is ignored, so that the counter can't wrap
+            consume = sigIncomingValue && (credits != 0);
+
+            creditsNext = credits;
+            // A value is issued and no value is drained --> consume a credit
+            if ((consume == 1) && (sigOutgoingValue == 0))
+            begin
+                creditsNext = credits - 1;
+            end
+            // A value is drained and no value is issued --> return a credit
+            if ((consume == 0) && (sigOutgoingValue == 1))
+            begin
+                creditsNext = credits + 1;
+            end
+            // In all other cases the number of credits stays the same
+
+            credits <= creditsNext;
+            creditAvailable <= creditsNext != 0;
+            almostFull <= creditsNext <= ALMOST_FULL_THRESHOLD[0 +: CREDIT_SIZE];
+            // All credits which are not available are in the pipeline or in the FIFO
+            valueInPipeline <= creditsNext != CREDITS[0 +: CREDIT_SIZE];
+        end
+    end
+endmodule
@@ -15,14 +15,26 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Just delays values. For instance, if the DELAY is configured to 4, the 
 // value in 'in' will appear after four clock cycles in 'out'. This is useful 
 // to implement equations with interim results to easily delay them to the 
 // next pipeline step.
+// Depending on the size of the delay, different implementations are used:
+//  - DELAY < SRL_THRESHOLD: A chain of flip flops.
+//  - DELAY >= SRL_THRESHOLD: A shift register without reset, which can be mapped
+//    into shift register LUTs (SRL16/SRL32) followed by a flip flop.
+//  - DELAY >= SRL_THRESHOLD and DELAY * VALUE_SIZE >= BRAM_THRESHOLD: A ring buffer
+//    with a read and a write pointer, which can be mapped into a block RAM.
+// All implementations have the same latency and are stalled by ce in the same way.
 // This module is pipelined
 module ValueDelay #(
     parameter VALUE_SIZE = 32,
-    parameter DELAY = 4
+    parameter DELAY = 4,
+    parameter SRL_THRESHOLD = 3, // Minimum delay in clock cycles to use shift register LUTs instead of flip flops
+    parameter BRAM_THRESHOLD = 8192, // Minimum number of stored bits (DELAY * VALUE_SIZE) to use a block RAM
+    localparam LATENCY = `VALUE_DELAY_LATENCY(DELAY)
 )
 (
     input  wire                         clk,
@@ -32,9 +44,34 @@ module ValueDelay #(
 );
     integer i;
     generate 
-        if (DELAY > 0)
+        if (DELAY <= 0)
+        begin
+            assign out = in;
+        end
+        else if ((DELAY >= 2) && (DELAY >= SRL_THRESHOLD) && ((DELAY * VALUE_SIZE) >= BRAM_THRESHOLD))
+        begin
+            // The ring buffer contains DELAY entries. The read pointer is always one entry
+            // ahead of the write pointer, so it points to the oldest value. Together with the
+            // output register of the RAM, the value needs DELAY clock cycles to reach 'out'.
+            // Read and write pointer never point to the same entry which avoids collisions.
+            localparam ADDR_SIZE = (DELAY > 1) ? $clog2(DELAY) : 1;
+            (* ram_style = "block" *) reg [VALUE_SIZE - 1 : 0] ring [0 : DELAY - 1];
+            reg  [VALUE_SIZE - 1 : 0]   ringOut;
+            reg  [ADDR_SIZE - 1 : 0]    writePtr = 0;
+            reg  [ADDR_SIZE - 1 : 0]    readPtr = 1;
+            always @(posedge clk)
+            if (ce) begin
+                ring[writePtr] <= in;
+                ringOut <= ring[readPtr];
+                writePtr <= (writePtr == (DELAY - 1)) ? 0 : writePtr + 1;
+                readPtr <= (readPtr == (DELAY - 1)) ? 0 : readPtr + 1;
+            end
+            assign out = ringOut;
+        end
+        else if (DELAY >= SRL_THRESHOLD)
         begin
-            reg  [VALUE_SIZE - 1 : 0] delay[0 : DELAY - 1];
+            // No reset and no access to the interim values, so that the synthesis can use shift register LUTs
+            (* srl_style = "srl_reg" *) reg  [VALUE_SIZE - 1 : 0] delay[0 : DELAY - 1];
             always @(posedge clk)
             if (ce) begin
                 for (i = 0; i < DELAY - 1; i = i + 1)
@@ -47,7 +84,16 @@ module ValueDelay #(
         end
         else
         begin
-            assign out = in;
+            (* srl_style = "register" *) reg  [VALUE_SIZE - 1 : 0] delay[0 : DELAY - 1];
+            always @(posedge clk)
+            if (ce) begin
+                for (i = 0; i < DELAY - 1; i = i + 1)
+                begin
+                    delay[i] <= delay[i + 1];
+                end
+                delay[DELAY - 1] <= in;
+            end
+            assign out = delay[0];
         end
     endgenerate
 endmodule
@@ -0,0 +1,99 @@
+// Float
+// https://github.com/ToNi3141/Float
+// Copyright (c) 2026 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Synchronous first word fall through FIFO.
+// It is intended to absorb the results of a pipeline which can't be stalled.
+// Combine it with a ValueCredit which has CREDITS = DEPTH:
+//  - The producer issues values into the pipeline while the ValueCredit has credits.
+//    The issue signal is connected to 'sigIncomingValue' of the ValueCredit.
+//  - The valid signal of the pipeline (for instance the issue signal delayed with
+//    a ValueDelay by the LATENCY of the pipeline) is connected to 'inValid'.
+//  - 'outValid && outReady' is connected to 'sigOutgoingValue' of the ValueCredit.
+// Values which are written into a full FIFO are dropped. This can't happen,
+// when the FIFO is used together with a ValueCredit.
+// The memory is read asynchronously, so that it can be mapped into distributed RAM.
+module ValueFifo
+#(
+    parameter VALUE_SIZE = 32,
+    parameter DEPTH = 16,
+    localparam ADDR_SIZE = (DEPTH > 1) ? $clog2(DEPTH) : 1,
+    localparam FILL_SIZE = $clog2(DEPTH + 1)
+)
+(
+    input  wire                         aclk,
+    input  wire                         resetn,
+
+    input  wire                         inValid,
+    input  wire [VALUE_SIZE - 1 : 0]    in,
+
+    output wire                         outValid,
+    input  wire                         outReady,
+    output wire [VALUE_SIZE - 1 : 0]    out,
+
+    output wire                         empty,
+    output wire                         full,
+    output reg  [FILL_SIZE - 1 : 0]     fill = 0
+);
+    (* ram_style = "distributed" *) reg [VALUE_SIZE - 1 : 0] ram [0 : DEPTH - 1];
+    reg  [ADDR_SIZE - 1 : 0] writePtr = 0;
+    reg  [ADDR_SIZE - 1 : 0] readPtr = 0;
+
+    wire write = inValid && !full;
+    wire read = outReady && !empty;
+
+    assign empty = fill == 0;
+    assign full = fill == DEPTH[0 +: FILL_SIZE];
+    assign outValid = !empty;
+    assign out = ram[readPtr];
+
+    always @(posedge aclk)
+    begin
+        if (write)
+        begin
+            ram[writePtr] <= in;
+        end
+    end
+
+    always @(posedge aclk)
+    begin
+        if (!resetn)
+        begin
+            writePtr <= 0;
+            readPtr <= 0;
+            fill <= 0;
+        end
+        else
+        begin
+            if (write)
+            begin
+                writePtr <= (writePtr == (DEPTH - 1)) ? 0 : writePtr + 1;
+            end
+            if (read)
+            begin
+                readPtr <= (readPtr == (DEPTH - 1)) ? 0 : readPtr + 1;
+            end
+            if (write && !read)
+            begin
+                fill <= fill + 1;
+            end
+            if (!write && read)
+            begin
+                fill <= fill - 1;
+            end
+        end
+    end
+endmodule
@@ -19,8 +19,15 @@
 // to give feedback if a value is still in the pipeline. 
 // This can be useful when it is required to check, if the pipeline is
 // empty or not.
+// The counter must be big enough to count all values which can be in the 
+// pipeline at the same time. With the default COUNTER_SIZE of 8, up to 255 values
+// can be tracked. The counter wraps when more values are in the pipeline.
+// See ValueCredit for a credit based flow control.
 // This module is pipelined
 module ValueTrack
+#(
+    parameter COUNTER_SIZE = 8 // Tracks up to 2^COUNTER_SIZE - 1 values
+)
 (
     input  wire aclk,
     input  wire resetn,
@@ -29,7 +36,7 @@ module ValueTrack
     input  wire sigOutgoingValue,
     output reg  valueInPipeline
 );
-    reg [7 : 0] valuesCounter = 0;
+    reg [COUNTER_SIZE - 1 : 0] valuesCounter = 0;
 
     always @(posedge aclk)
     begin
@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+`include "FloatLatency.vh"
+
 // Integer reciprocal
 // It automatically normalizes a number to calculate the reciprocal of that.
 // If the input number is a integer number in the format Q10.0, then the output
@@ -28,7 +30,8 @@ module XRecip
     parameter NUMBER_WIDTH = 24,
     parameter ITERATIONS = 2,
     localparam SIGNED_NUMBER_WIDTH = NUMBER_WIDTH + 1,
-    localparam EXPONENT_SIZE = $clog2(NUMBER_WIDTH) + 1
+    localparam EXPONENT_SIZE = $clog2(NUMBER_WIDTH) + 1,
+    localparam LATENCY = `XRECIP_LATENCY(ITERATIONS)
 )
 (
     input  wire                                         clk,
@@ -89,7 +92,7 @@ module XRecip
         .v(step2_number)
     );
 
-    ValueDelay #(.VALUE_SIZE(EXPONENT_SIZE), .DELAY(10)) 
+    ValueDelay #(.VALUE_SIZE(EXPONENT_SIZE), .DELAY(`COMPUTE_RECIP_LATENCY(ITERATIONS))) 
         step2exponent (.clk(clk), .ce(ce), .in(step1_exponent), .out(step2_exponent));
 
 